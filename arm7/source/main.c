@@ -0,0 +1,80 @@
+#include <nds.h>
+#include "offload.h"
+
+// The stock libnds ARM7 duties (input, clock, power) run from interrupts, the
+// main loop computes the curves the ARM9 posts through the shared Offload block
+
+volatile bool exitflag = false;
+
+void VblankHandler(void)
+{
+}
+
+void VcountHandler()
+{
+	inputGetAndSend();
+}
+
+void powerButtonCB()
+{
+	exitflag = true;
+}
+
+int main()
+{
+	readUserSettings();
+	ledBlink(0);
+
+	irqInit();
+	initClockIRQ();
+	fifoInit();
+	touchInit();
+
+	SetYtrigger(80);
+
+	installSystemFIFO();
+
+	irqSet(IRQ_VCOUNT, VcountHandler);
+	irqSet(IRQ_VBLANK, VblankHandler);
+
+	irqEnable(IRQ_VBLANK | IRQ_VCOUNT);
+
+	setPowerButtonCB(powerButtonCB);
+
+    Offload* offload = 0;
+    u32 lastFrame = 0;
+	while (!exitflag)
+	{
+		if (0 == (REG_KEYINPUT & (KEY_SELECT | KEY_START | KEY_L | KEY_R)))
+		{
+			exitflag = true;
+		}
+
+        if (!offload)
+        {
+            if (fifoCheckAddress(FIFO_USER_01))
+            {
+                offload = (Offload*)fifoGetAddress(FIFO_USER_01);
+            }
+            else
+            {
+                swiWaitForVBlank();
+            }
+        }
+        else if (!OffloadWork(offload, &lastFrame))
+        {
+            // Sleep until the ARM9 signals a frame rather than polling main
+            // RAM, waking at vblank too for the exit combo. The signal may be
+            // for a frame already computed, which costs one more look
+            if (fifoCheckValue32(OFFLOADFIFO))
+            {
+                fifoGetValue32(OFFLOADFIFO);
+            }
+            else
+            {
+                swiIntrWait(0, IRQ_FIFO_NOT_EMPTY | IRQ_VBLANK);
+            }
+        }
+	}
+	return 0;
+}
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "governor.h"
+
+// Built for ARMv5TE and run under qemu-arm by "make armcheck": renders each view
+// with kernelarm.s and with the C kernel and requires identical frames and erase lists
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+static EraseList eraseList;
+static EraseList referenceList;
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: armcheck [-n views] [-s stride]\n"
+        "  -n  number of animationTime values to check (default 4096)\n"
+        "  -s  animationTime step between views (default 7)\n");
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 views = 4096;
+    s32 stride = 7;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': views = atoi(optarg); break;
+            case 's': stride = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (views <= 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    // Sweep zoom, pan and governor level alongside time so clipping on every
+    // edge, negative scales and partial curve sets are all exercised
+    static const s32 scales[] = { SCALEMUL, SCALEMUL*4, SCALEMUL/3, 8191, -SCALEMUL, -8192, 1 };
+    const s32 scaleCount = sizeof(scales)/sizeof(scales[0]);
+
+    s32 failures = 0;
+    u32 plotted = 0;
+    for (s32 i = 0; i < views; ++i)
+    {
+        View view = { i*stride, scales[i%scaleCount], (i%97) - 48, (i%61) - 30, CURVES, ITERATIONS };
+        GovernorQuality(i%GOVERNORLEVELS, &view);
+
+        memset(buffer, 0, sizeof(buffer));
+        memset(reference, 0, sizeof(reference));
+        ArmKernelEnabled = true;
+        RenderFrame(buffer, &view, &eraseList, 0);
+        ArmKernelEnabled = false;
+        RenderFrame(reference, &view, &referenceList, 0);
+
+        if (memcmp(buffer, reference, sizeof(buffer)) || eraseList.count != referenceList.count ||
+            memcmp(eraseList.offsets, referenceList.offsets, eraseList.count*sizeof(u16)))
+        {
+            fprintf(stderr, "time %d scale %d pan %d,%d curves %u iterations %u: assembly differs (%u vs %u plotted)\n",
+                    view.animationTime, view.scaleMul, view.xPan, view.yPan, view.curves, view.iterations,
+                    eraseList.count, referenceList.count);
+            ++failures;
+        }
+        plotted += referenceList.count;
+    }
+
+    printf("views %d plotted %u mismatches %d\n", views, plotted, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "profiler.h"
+#include "hostutil.h"
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u8 buffer8[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+static u8 reference8[SCREENWIDTH*SCREENHEIGHT];
+static u16 fadePalette[PALETTESIZE];
+static FadeState fade;
+static PointCache pointCache;
+static Profiler profiler;
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: bench [-n frames] [-t time] [-s speed] [-z scale] [-x xpan] [-y ypan] [-p] [-f] [-c] [-P] [-q]\n"
+        "  -n  number of frames to render (default 600)\n"
+        "  -t  starting animationTime (default 0)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -z  scaleMul (default %d)\n"
+        "  -x  xPan, -y yPan (default 0)\n"
+        "  -p  render the 8bpp paletted framebuffer\n"
+        "  -f  render fading trails, hashing the palette-resolved frame\n"
+        "  -c  pause and pan one pixel per frame, re-projecting from the point cache\n"
+        "  -P  write per-frame phase timings (ns) as CSV and summarise the last %d frames\n"
+        "  -q  do not print per-frame hashes\n",
+        SCALEMUL, PROFILEFRAMES);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 600;
+    s32 speed = 8;
+    bool paletted = false;
+    bool fading = false;
+    bool cached = false;
+    bool profile = false;
+    bool quiet = false;
+    View view = { 0, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:t:s:z:x:y:pfcPq")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 't': view.animationTime = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'z': view.scaleMul = atoi(optarg); break;
+            case 'x': view.xPan = atoi(optarg); break;
+            case 'y': view.yPan = atoi(optarg); break;
+            case 'p': paletted = true; break;
+            case 'f': fading = true; break;
+            case 'c': cached = true; speed = 0; break;
+            case 'P': profile = true; break;
+            case 'q': quiet = true; break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0 || (cached && fading))
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+    InitPalette();
+    InitFade(buffer8, &fade);
+    InitProfiler(&profiler);
+
+    FILE* summary = stdout;
+    if (profile)
+    {
+        summary = stderr;
+        printf("frame,time,scalemul,xpan,ypan,hash");
+        for (u32 phase = 0; phase < PHASECOUNT; ++phase)
+        {
+            printf(",%s", PhaseNames[phase]);
+        }
+        printf("\n");
+    }
+
+    u64 totalNs = 0;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        View shown = view;
+        u64 startNs = NowNs();
+        u64 clearNs = startNs;
+        if (fading)
+        {
+            RenderFadeFrame(buffer8, &view, &fade);
+            FadePalette(&fade, fadePalette);
+        }
+        else if (paletted)
+        {
+            memset(buffer8, 0, sizeof(buffer8));
+            clearNs = NowNs();
+            if (pointCache.valid)
+            {
+                PlotCachedFrame8(buffer8, &view, 0, &pointCache);
+            }
+            else
+            {
+                RenderFrame8(buffer8, &view, 0, cached ? &pointCache : 0);
+            }
+        }
+        else
+        {
+            memset(buffer, 0, sizeof(buffer));
+            clearNs = NowNs();
+            if (pointCache.valid)
+            {
+                PlotCachedFrame(buffer, &view, 0, &pointCache);
+            }
+            else
+            {
+                RenderFrame(buffer, &view, 0, cached ? &pointCache : 0);
+            }
+        }
+        u64 endNs = NowNs();
+        totalNs += endNs - startNs;
+        ProfilerRecord(&profiler, PHASECLEAR, clearNs - startNs);
+        ProfilerRecord(&profiler, PHASEKERNEL, endNs - clearNs);
+
+        if (cached)
+        {
+            bool same;
+            if (paletted)
+            {
+                memset(reference8, 0, sizeof(reference8));
+                RenderFrame8(reference8, &view, 0, 0);
+                same = !memcmp(buffer8, reference8, sizeof(buffer8));
+            }
+            else
+            {
+                memset(reference, 0, sizeof(reference));
+                RenderFrame(reference, &view, 0, 0);
+                same = !memcmp(buffer, reference, sizeof(buffer));
+            }
+            if (!same)
+            {
+                fprintf(stderr, "cached frame %d differs from the live render\n", frame);
+                return 1;
+            }
+            view.xPan++;
+        }
+
+        if (!quiet || profile)
+        {
+            u64 hudNs = NowNs();
+            if (fading)
+            {
+                ResolvePalette(buffer8, fadePalette, buffer);
+            }
+            u32 hash = paletted && !fading ? HashPixels(buffer8, sizeof(buffer8)) : HashFrame(buffer);
+            ProfilerRecord(&profiler, PHASEHUD, NowNs() - hudNs);
+
+            if (profile)
+            {
+                const u32* samples = profiler.samples[profiler.frame];
+                printf("%d,%d,%d,%d,%d,%08x", frame, shown.animationTime, shown.scaleMul, shown.xPan, shown.yPan, hash);
+                for (u32 phase = 0; phase < PHASECOUNT; ++phase)
+                {
+                    printf(",%u", samples[phase]);
+                }
+                printf("\n");
+            }
+            else
+            {
+                printf("frame %d time %d hash %08x\n", frame, shown.animationTime, hash);
+            }
+        }
+        ProfilerEndFrame(&profiler);
+        view.animationTime += speed;
+    }
+
+    double nsPerFrame = (double)totalNs / frames;
+    fprintf(summary, "curves %d iterations %d particles %d\n", CURVES, ITERATIONS, PARTICLECOUNT);
+    fprintf(summary, "frames %d ns/frame %.0f particles/s %.0f\n", frames, nsPerFrame, PARTICLECOUNT * 1e9 / nsPerFrame);
+    if (profile)
+    {
+        PhaseStats stats;
+        fprintf(summary, "%-8s %10s %10s %10s %10s\n", "phase", "min", "avg", "p95", "max");
+        for (u32 phase = 0; phase < PHASECOUNT; ++phase)
+        {
+            ProfilerStats(&profiler, phase, &stats);
+            fprintf(summary, "%-8s %10u %10u %10u %10u\n", PhaseNames[phase], stats.min, stats.avg, stats.p95, stats.max);
+        }
+        ProfilerFrameStats(&profiler, &stats);
+        fprintf(summary, "%-8s %10u %10u %10u %10u\n", "Frame", stats.min, stats.avg, stats.p95, stats.max);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "render.h"
+#include "hostutil.h"
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static EraseList eraseList;
+
+// Times a whole-screen fill, a bare erase-list walk and EraseFrame itself, which
+// picks between the two at ERASEFILLTHRESHOLD. The threshold is tuned for DMA
+// fill against ARM9 stores on the DS; on the host memset is far cheaper
+// relative to scattered stores, so the list can lose well below it here
+
+static const s32 scales[] = { SCALEMUL/4, SCALEMUL/2, SCALEMUL, SCALEMUL*2, SCALEMUL*4, SCALEMUL*8, SCALEMUL*16, SCALEMUL*32 };
+
+static bool IsClear()
+{
+    for (u32 i = 0; i < SCREENWIDTH*SCREENHEIGHT; ++i)
+    {
+        if (buffer[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 200;
+    s32 speed = 8;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: clearbench [-n frames] [-s speed]\n");
+                return 1;
+        }
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    printf("EraseFrame fills from %d plotted, a threshold tuned for the DS DMA fill, not this host\n", ERASEFILLTHRESHOLD);
+    printf("%10s %10s %12s %12s %12s %6s\n", "scaleMul", "plotted", "fill ns", "list ns", "erase ns", "path");
+    for (u32 s = 0; s < sizeof(scales)/sizeof(scales[0]); ++s)
+    {
+        View view = { 0, scales[s], 0, 0, CURVES, ITERATIONS };
+        u64 plotted = 0, fillNs = 0, listNs = 0, eraseNs = 0;
+        u32 fills = 0;
+        for (s32 frame = 0; frame < frames; ++frame)
+        {
+            RenderFrame(buffer, &view, &eraseList, 0);
+            plotted += eraseList.count;
+
+            u64 startNs = NowNs();
+            FillWords(0, buffer, SCREENWIDTH*SCREENHEIGHT*2);
+            fillNs += NowNs() - startNs;
+
+            RenderFrame(buffer, &view, &eraseList, 0);
+            startNs = NowNs();
+            const u16* offsets = eraseList.offsets;
+            for (u32 i = 0; i < eraseList.count; ++i)
+            {
+                buffer[offsets[i]] = 0;
+            }
+            listNs += NowNs() - startNs;
+
+            if (!IsClear())
+            {
+                fprintf(stderr, "erase list missed pixels at scaleMul %d frame %d\n", view.scaleMul, frame);
+                return 1;
+            }
+
+            RenderFrame(buffer, &view, &eraseList, 0);
+            fills += eraseList.count >= ERASEFILLTHRESHOLD;
+            startNs = NowNs();
+            EraseFrame(buffer, &eraseList);
+            eraseNs += NowNs() - startNs;
+
+            if (!IsClear())
+            {
+                fprintf(stderr, "EraseFrame missed pixels at scaleMul %d frame %d\n", view.scaleMul, frame);
+                return 1;
+            }
+            view.animationTime += speed;
+        }
+        plotted /= frames;
+        printf("%10d %10d %12.0f %12.0f %12.0f %6s\n", scales[s], (s32)plotted, (double)fillNs/frames, (double)listNs/frames,
+            (double)eraseNs/frames, !fills ? "list" : fills == frames ? "fill" : "mixed");
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "hostutil.h"
+
+// Deep-zoom benchmark for view culling: renders the same frames with and
+// without it from the default scale up past the ARM kernel's limit, then at
+// pans that miss the screen entirely, requiring identical frames, erase lists
+// and point caches
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+static EraseList eraseList;
+static EraseList referenceList;
+static PointCache pointCache;
+static PointCache referenceCache;
+
+static const s32 scales[] = { SCALEMUL, 600, 1200, 2400, 4800, 8101, 16000, 32000, -4800 };
+#define SCALES (sizeof(scales)/sizeof(scales[0]))
+static const s32 offscreenPans[][2] = { { 2000, 0 }, { 0, 1000 }, { -2000, -900 } };
+#define OFFSCREENPANS (sizeof(offscreenPans)/sizeof(offscreenPans[0]))
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: cullbench [-n frames] [-s speed] [-x xpan] [-y ypan]\n"
+        "  -n  frames per scale (default 120)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -x  -y  pan (default 0)\n");
+    exit(1);
+}
+
+static u64 RenderFrames(s32 frames, s32 speed, const View* start, u16* target, EraseList* list, bool culling, s32* failures)
+{
+    CullingEnabled = culling;
+    u64 totalNs = 0;
+    View view = *start;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        memset(target, 0, sizeof(buffer));
+        u64 startNs = NowNs();
+        RenderFrame(target, &view, list, 0);
+        totalNs += NowNs() - startNs;
+
+        if (failures)
+        {
+            CullingEnabled = false;
+            memset(reference, 0, sizeof(reference));
+            RenderFrame(reference, &view, &referenceList, &referenceCache);
+            CullingEnabled = true;
+            if (memcmp(target, reference, sizeof(reference)) || list->count != referenceList.count ||
+                memcmp(list->offsets, referenceList.offsets, list->count*sizeof(u16)))
+            {
+                fprintf(stderr, "scale %d pan %d %d time %d: culled frame differs\n", view.scaleMul, view.xPan, view.yPan, view.animationTime);
+                ++*failures;
+            }
+
+            // Filling a point cache takes the culled path too
+            memset(target, 0, sizeof(buffer));
+            RenderFrame(target, &view, 0, &pointCache);
+            if (memcmp(target, reference, sizeof(reference)) ||
+                memcmp(pointCache.points, referenceCache.points, view.curves*view.iterations*sizeof(s32)))
+            {
+                fprintf(stderr, "scale %d pan %d %d time %d: culled point cache differs\n", view.scaleMul, view.xPan, view.yPan, view.animationTime);
+                ++*failures;
+            }
+        }
+        view.animationTime += speed;
+    }
+    return totalNs;
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 120;
+    s32 speed = 8;
+    s32 xPan = 0, yPan = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:x:y:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'x': xPan = atoi(optarg); break;
+            case 'y': yPan = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    s32 failures = 0;
+    printf("%-16s %10s %12s %12s %8s\n", "scale/pan", "plotted", "plain ns", "culled ns", "speedup");
+    for (u32 i = 0; i < SCALES + OFFSCREENPANS; ++i)
+    {
+        View view = { 0, SCALEMUL, xPan, yPan, CURVES, ITERATIONS };
+        char label[32];
+        if (i < SCALES)
+        {
+            view.scaleMul = scales[i];
+            snprintf(label, sizeof(label), "%d", scales[i]);
+        }
+        else
+        {
+            view.xPan = offscreenPans[i - SCALES][0];
+            view.yPan = offscreenPans[i - SCALES][1];
+            snprintf(label, sizeof(label), "off %d,%d", view.xPan, view.yPan);
+        }
+        const u64 plainNs = RenderFrames(frames, speed, &view, buffer, &eraseList, false, 0);
+        const u64 culledNs = RenderFrames(frames, speed, &view, buffer, &eraseList, true, &failures);
+        printf("%-16s %10u %12.0f %12.0f %8.2f\n", label, eraseList.count,
+            (double)plainNs/frames, (double)culledNs/frames, (double)plainNs/culledNs);
+    }
+
+    printf("mismatches %d\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "render.h"
+#include "hires.h"
+#include "hostutil.h"
+
+// Headless video export: worker threads render and convert frames in any order
+// into a fixed ring of slots, the main thread streams them out in order. A
+// worker may only claim a frame whose slot the writer has already emptied, so
+// the reorder window is the slot count and nothing is allocated per frame
+
+#define FORMATY4M 0
+#define FORMATRGB 1
+
+typedef struct
+{
+    HiresTarget target;
+    u8* bytes;
+    bool ready;
+} ExportSlot;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    u32 frames;
+    u32 claimed;
+    u32 written;
+    u32 slotCount;
+    ExportSlot* slots;
+    View view;
+    s32 speed;
+    u32 format;
+} Export;
+
+static inline u8 Expand5(u32 value)
+{
+    return (value<<3) | (value>>2);
+}
+
+// RGB15 to packed RGB24, or to the three planes of BT.601 studio-range 4:4:4
+static void ConvertFrame(const HiresTarget* target, u32 format, u8* bytes)
+{
+    const u32 pixels = target->width*target->height;
+    u8* yPlane = bytes;
+    u8* uPlane = bytes + pixels;
+    u8* vPlane = bytes + 2*pixels;
+    for (u32 i = 0; i < pixels; ++i)
+    {
+        const u16 colour = target->pixels[i];
+        const s32 red = Expand5(colour & 31);
+        const s32 green = Expand5((colour>>5) & 31);
+        const s32 blue = Expand5((colour>>10) & 31);
+        if (format == FORMATRGB)
+        {
+            *bytes++ = red;
+            *bytes++ = green;
+            *bytes++ = blue;
+        }
+        else
+        {
+            yPlane[i] = ((66*red + 129*green + 25*blue + 128)>>8) + 16;
+            uPlane[i] = ((-38*red - 74*green + 112*blue + 128)>>8) + 128;
+            vPlane[i] = ((112*red - 94*green - 18*blue + 128)>>8) + 128;
+        }
+    }
+}
+
+static void* ExportWorker(void* arg)
+{
+    Export* export = arg;
+    pthread_mutex_lock(&export->lock);
+    while (export->claimed < export->frames)
+    {
+        const u32 frame = export->claimed;
+        if (frame >= export->written + export->slotCount)
+        {
+            pthread_cond_wait(&export->changed, &export->lock);
+            continue;
+        }
+        ++export->claimed;
+        pthread_mutex_unlock(&export->lock);
+
+        ExportSlot* slot = &export->slots[frame % export->slotCount];
+        View view = export->view;
+        view.animationTime += frame*export->speed;
+        ClearHiresTarget(&slot->target);
+        RenderHiresDirect(&slot->target, &view);
+        ConvertFrame(&slot->target, export->format, slot->bytes);
+
+        pthread_mutex_lock(&export->lock);
+        slot->ready = true;
+        pthread_cond_broadcast(&export->changed);
+    }
+    pthread_mutex_unlock(&export->lock);
+    return 0;
+}
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: export [-o file] [-f y4m|rgb] [-r widthxheight] [-n frames] [-t time] [-s speed]\n"
+        "              [-z scale] [-x xpan] [-y ypan] [-j threads] [-q slots] [-F fps]\n"
+        "  -o  output file (default stdout)\n"
+        "  -f  YUV4MPEG2 4:4:4 or raw RGB24 (default y4m)\n"
+        "  -r  frame size (default %dx%d)\n"
+        "  -n  number of frames (default 600)\n"
+        "  -t  animationTime of the first frame (default 0)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -z  scaleMul at 192 lines (default %d)\n"
+        "  -x  -y  pan at 192 lines (default 0)\n"
+        "  -j  render threads (default the online CPU count)\n"
+        "  -q  frames in flight (default twice the threads)\n"
+        "  -F  frame rate written to the Y4M header (default 60)\n",
+        SCREENWIDTH, SCREENHEIGHT, SCALEMUL);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = "-";
+    u32 format = FORMATY4M;
+    u32 width = SCREENWIDTH, height = SCREENHEIGHT;
+    s32 frames = 600;
+    s32 threads = sysconf(_SC_NPROCESSORS_ONLN);
+    s32 slotCount = 0;
+    s32 fps = 60;
+    View view = { 0, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+    s32 speed = 8;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "o:f:r:n:t:s:z:x:y:j:q:F:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'o': path = optarg; break;
+            case 'f':
+                if (!strcmp(optarg, "y4m")) format = FORMATY4M;
+                else if (!strcmp(optarg, "rgb")) format = FORMATRGB;
+                else Usage();
+                break;
+            case 'r': if (sscanf(optarg, "%ux%u", &width, &height) != 2) Usage(); break;
+            case 'n': frames = atoi(optarg); break;
+            case 't': view.animationTime = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'z': view.scaleMul = atoi(optarg); break;
+            case 'x': view.xPan = atoi(optarg); break;
+            case 'y': view.yPan = atoi(optarg); break;
+            case 'j': threads = atoi(optarg); break;
+            case 'q': slotCount = atoi(optarg); break;
+            case 'F': fps = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0 || threads <= 0 || slotCount < 0 || fps <= 0)
+    {
+        Usage();
+    }
+    if (!slotCount)
+    {
+        slotCount = 2*threads;
+    }
+
+    FILE* out = strcmp(path, "-") ? fopen(path, "wb") : stdout;
+    if (!out)
+    {
+        fprintf(stderr, "could not open %s\n", path);
+        return 1;
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    Export export = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, frames, 0, 0, slotCount, 0, view, speed, format };
+    const u32 frameBytes = 3*width*height;
+    export.slots = calloc(slotCount, sizeof(ExportSlot));
+    for (s32 i = 0; export.slots && i < slotCount; ++i)
+    {
+        ExportSlot* slot = &export.slots[i];
+        slot->bytes = malloc(frameBytes);
+        if (!slot->bytes || !InitHiresTarget(&slot->target, width, height, 6))
+        {
+            fprintf(stderr, "could not allocate %d %ux%u frames\n", slotCount, width, height);
+            return 1;
+        }
+    }
+
+    if (format == FORMATY4M)
+    {
+        fprintf(out, "YUV4MPEG2 W%u H%u F%d:1 Ip A1:1 C444\n", width, height, fps);
+    }
+
+    const u64 startNs = NowNs();
+    pthread_t* workers = malloc(threads*sizeof(pthread_t));
+    for (s32 i = 0; i < threads; ++i)
+    {
+        if (pthread_create(&workers[i], 0, ExportWorker, &export))
+        {
+            fprintf(stderr, "could not start render thread %d\n", i);
+            return 1;
+        }
+    }
+
+    bool failed = false;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        ExportSlot* slot = &export.slots[frame % slotCount];
+        pthread_mutex_lock(&export.lock);
+        while (!slot->ready)
+        {
+            pthread_cond_wait(&export.changed, &export.lock);
+        }
+        pthread_mutex_unlock(&export.lock);
+
+        if (!failed && ((format == FORMATY4M && fputs("FRAME\n", out) < 0) || fwrite(slot->bytes, frameBytes, 1, out) != 1))
+        {
+            fprintf(stderr, "write failed at frame %d\n", frame);
+            failed = true;
+        }
+
+        // Keep draining after a failure so the workers can finish
+        pthread_mutex_lock(&export.lock);
+        slot->ready = false;
+        ++export.written;
+        pthread_cond_broadcast(&export.changed);
+        pthread_mutex_unlock(&export.lock);
+    }
+
+    for (s32 i = 0; i < threads; ++i)
+    {
+        pthread_join(workers[i], 0);
+    }
+    if (fflush(out) || (out != stdout && fclose(out)))
+    {
+        failed = true;
+    }
+    const double seconds = (NowNs() - startNs)*1e-9;
+
+    for (s32 i = 0; i < slotCount; ++i)
+    {
+        FreeHiresTarget(&export.slots[i].target);
+        free(export.slots[i].bytes);
+    }
+    free(export.slots);
+    free(workers);
+
+    fprintf(stderr, "%d frames %ux%u in %.2fs, %.1f fps, %.1fx real time\n",
+        frames, width, height, seconds, frames/seconds, frames/seconds/fps);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "framering.h"
+#include "hostutil.h"
+
+#define FRAMERINGPAGE 4096
+#define ROUNDUP(value, size) (((value) + (size) - 1) & ~(size_t)((size) - 1))
+
+bool CreateFrameRing(FrameRing* ring, const char* name, u32 width, u32 height, u32 slots)
+{
+    memset(ring, 0, sizeof(FrameRing));
+    if (!width || !height || slots < 2 || slots > FRAMERINGMAXSLOTS || strlen(name) >= sizeof(ring->name))
+    {
+        return false;
+    }
+
+    const size_t pixelsOffset = ROUNDUP(sizeof(FrameRingHeader), FRAMERINGPAGE);
+    const size_t slotBytes = ROUNDUP((size_t)width*height*sizeof(u16), FRAMERINGPAGE);
+    ring->bytes = pixelsOffset + slots*slotBytes;
+
+    shm_unlink(name);
+    const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+    void* base = MAP_FAILED;
+    if (ftruncate(fd, ring->bytes) == 0)
+    {
+        base = mmap(0, ring->bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        shm_unlink(name);
+        return false;
+    }
+
+    ring->base = base;
+    ring->header = base;
+    ring->owner = true;
+    strcpy(ring->name, name);
+
+    // The pages start zeroed, so only the layout needs filling in; readers
+    // ignore the ring until the magic is published
+    FrameRingHeader* header = ring->header;
+    header->version = FRAMERINGVERSION;
+    header->width = width;
+    header->height = height;
+    header->slotCount = slots;
+    header->slotBytes = slotBytes;
+    header->pixelsOffset = pixelsOffset;
+    StoreRelease(&header->magic, FRAMERINGMAGIC);
+    return true;
+}
+
+bool OpenFrameRing(FrameRing* ring, const char* name)
+{
+    memset(ring, 0, sizeof(FrameRing));
+    const int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    void* base = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(FrameRingHeader))
+    {
+        base = mmap(0, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        return false;
+    }
+
+    ring->base = base;
+    ring->header = base;
+    ring->bytes = info.st_size;
+    const FrameRingHeader* header = ring->header;
+    if (LoadAcquire(&header->magic) != FRAMERINGMAGIC || header->version != FRAMERINGVERSION ||
+        header->pixelsOffset + (size_t)header->slotCount*header->slotBytes > ring->bytes)
+    {
+        CloseFrameRing(ring);
+        return false;
+    }
+    return true;
+}
+
+void CloseFrameRing(FrameRing* ring)
+{
+    if (ring->base)
+    {
+        munmap(ring->base, ring->bytes);
+    }
+    if (ring->owner)
+    {
+        shm_unlink(ring->name);
+    }
+    memset(ring, 0, sizeof(FrameRing));
+}
+
+u32 RingFrameSlot(const FrameRing* ring)
+{
+    return ring->nextFrame % ring->header->slotCount;
+}
+
+// The odd sequence has to be visible before any pixel of the new frame, hence
+// the fence rather than just a release store
+u16* BeginRingFrame(FrameRing* ring)
+{
+    const u32 slot = RingFrameSlot(ring);
+    FrameSlot* frameSlot = &ring->header->slots[slot];
+    __atomic_store_n(&frameSlot->sequence, frameSlot->sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return (u16*)(ring->base + ring->header->pixelsOffset + (size_t)slot*ring->header->slotBytes);
+}
+
+void EndRingFrame(FrameRing* ring)
+{
+    FrameSlot* frameSlot = &ring->header->slots[RingFrameSlot(ring)];
+    __atomic_store_n(&frameSlot->frame, ring->nextFrame, __ATOMIC_RELAXED);
+    __atomic_store_n(&frameSlot->timeNs, NowNs(), __ATOMIC_RELAXED);
+    StoreRelease(&frameSlot->sequence, frameSlot->sequence + 1);
+    __atomic_store_n(&ring->header->published, ++ring->nextFrame, __ATOMIC_RELEASE);
+}
+
+// published counts frames, so the latest is published-1. A slot caught mid
+// write means the producer has lapped this reader, so look again
+bool AcquireLatestFrame(const FrameRing* ring, RingFrame* frame)
+{
+    const FrameRingHeader* header = ring->header;
+    for (;;)
+    {
+        const u64 published = __atomic_load_n(&header->published, __ATOMIC_ACQUIRE);
+        if (!published)
+        {
+            return false;
+        }
+        const u32 slot = (published - 1) % header->slotCount;
+        const FrameSlot* frameSlot = &header->slots[slot];
+        const u32 sequence = LoadAcquire(&frameSlot->sequence);
+        if (sequence & 1)
+        {
+            continue;
+        }
+        frame->pixels = (const u16*)(ring->base + header->pixelsOffset + (size_t)slot*header->slotBytes);
+        frame->frame = __atomic_load_n(&frameSlot->frame, __ATOMIC_RELAXED);
+        frame->timeNs = __atomic_load_n(&frameSlot->timeNs, __ATOMIC_RELAXED);
+        frame->slot = slot;
+        frame->sequence = sequence;
+        if (RingFrameIntact(ring, frame))
+        {
+            return true;
+        }
+    }
+}
+
+bool RingFrameIntact(const FrameRing* ring, const RingFrame* frame)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&ring->header->slots[frame->slot].sequence, __ATOMIC_RELAXED) == frame->sequence;
+}
@@ -0,0 +1,73 @@
+#ifndef FRAMERING_H
+#define FRAMERING_H
+
+#include <stddef.h>
+#include "platform.h"
+
+// A POSIX shared-memory ring of 16bpp framebuffers. The producer renders
+// straight into the next slot and never waits; readers map the ring read-only,
+// look at the latest complete frame in place and check afterwards that the
+// producer did not lap them while they read
+
+#define FRAMERINGMAGIC 0x474e4952
+#define FRAMERINGVERSION 1
+#define FRAMERINGMAXSLOTS 64
+#define FRAMERINGNAME "/bubbleuniverse"
+
+// A seqlock per slot: sequence is odd while the producer is writing the slot
+typedef struct
+{
+    u32 sequence;
+    u32 width;
+    u64 frame;
+    u64 timeNs;
+} __attribute__((aligned(64))) FrameSlot;
+
+typedef struct
+{
+    u32 magic;
+    u32 version;
+    u32 width;
+    u32 height;
+    u32 slotCount;
+    u32 slotBytes;
+    u64 pixelsOffset;
+    u64 published __attribute__((aligned(64)));
+    FrameSlot slots[FRAMERINGMAXSLOTS];
+} FrameRingHeader;
+
+typedef struct
+{
+    FrameRingHeader* header;
+    u8* base;
+    size_t bytes;
+    bool owner;
+    char name[64];
+    u64 nextFrame;
+} FrameRing;
+
+typedef struct
+{
+    const u16* pixels;
+    u64 frame;
+    u64 timeNs;
+    u32 slot;
+    u32 sequence;
+} RingFrame;
+
+bool CreateFrameRing(FrameRing* ring, const char* name, u32 width, u32 height, u32 slots);
+bool OpenFrameRing(FrameRing* ring, const char* name);
+void CloseFrameRing(FrameRing* ring);
+
+// Producer: the slot to render the next frame into, then publish it
+u16* BeginRingFrame(FrameRing* ring);
+void EndRingFrame(FrameRing* ring);
+u32 RingFrameSlot(const FrameRing* ring);
+
+// Readers: false until the first frame is published; the frame stays readable
+// in place until the producer comes round to its slot again, which
+// RingFrameIntact reports once the reader is done with it
+bool AcquireLatestFrame(const FrameRing* ring, RingFrame* frame);
+bool RingFrameIntact(const FrameRing* ring, const RingFrame* frame);
+
+#endif
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "governor.h"
+
+#define MAXFRAMES 65536
+#define OVERHEADUSEC 600
+
+static u32 trace[MAXFRAMES];
+
+static u32 LoadTrace(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    if (!file)
+    {
+        perror(path);
+        exit(1);
+    }
+    u32 frames = 0;
+    while (frames < MAXFRAMES && fscanf(file, "%u", &trace[frames]) == 1)
+    {
+        frames++;
+    }
+    fclose(file);
+    return frames;
+}
+
+// Full-quality compute times shaped like a session on hardware: a light view,
+// a zoom that doubles the cost, a ramp back out, the 21989 slow frame spike and
+// a view that sits just over budget
+static u32 SynthesiseTrace()
+{
+    u32 frames = 0;
+    u32 seed = 12345;
+    for (u32 i = 0; i < 1500; ++i)
+    {
+        u32 usec;
+        if (i < 300) usec = 11000;
+        else if (i < 600) usec = 24000;
+        else if (i < 900) usec = 24000 - (i-600)*50;
+        else if (i == 900) usec = 40000;
+        else usec = 17000;
+
+        seed = seed*1103515245 + 12345;
+        s32 noise = (s32)((seed>>16)%61) - 30;
+        trace[frames++] = usec + (s32)usec*noise/1000;
+    }
+    return frames;
+}
+
+// A rise and fall only counts as a bounce if the load itself stayed within 10%
+static bool SteadyLoad(u32 first, u32 last)
+{
+    u32 low = trace[first], high = trace[first];
+    for (u32 i = first; i <= last; ++i)
+    {
+        low = trace[i] < low ? trace[i] : low;
+        high = trace[i] > high ? trace[i] : high;
+    }
+    return high*10 < low*11;
+}
+
+int main(int argc, char** argv)
+{
+    u32 budget = GOVERNORBUDGET;
+    bool verbose = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "b:v")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b': budget = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            default:
+                fprintf(stderr, "usage: governorsim [-b budget usec] [-v] [trace file of full-quality usec per frame]\n");
+                return 1;
+        }
+    }
+    u32 frames = optind < argc ? LoadTrace(argv[optind]) : SynthesiseTrace();
+
+    Governor governor;
+    InitGovernor(&governor, budget);
+
+    u32 overBudget = 0, changes = 0, bounces = 0;
+    s32 lastLevel = governor.level;
+    s32 lastDirection = 0;
+    u32 lastRiseFrame = 0;
+    if (verbose)
+    {
+        printf("frame,fullusec,level,particles,usec\n");
+    }
+    for (u32 frame = 0; frame < frames; ++frame)
+    {
+        View view;
+        GovernorQuality(governor.level, &view);
+        const u32 particles = view.curves * view.iterations;
+        const u32 usec = OVERHEADUSEC + (u64)(trace[frame] - OVERHEADUSEC) * particles / PARTICLECOUNT;
+        if (verbose)
+        {
+            printf("%u,%u,%d,%u,%u\n", frame, trace[frame], governor.level, particles, usec);
+        }
+        overBudget += usec > budget;
+
+        UpdateGovernor(&governor, usec);
+        if (governor.level != lastLevel)
+        {
+            s32 direction = governor.level > lastLevel ? 1 : -1;
+            changes++;
+            if (direction < 0 && lastDirection > 0 && frame - lastRiseFrame < 2*GOVERNORSETTLE && SteadyLoad(lastRiseFrame, frame))
+            {
+                bounces++;
+            }
+            if (direction > 0)
+            {
+                lastRiseFrame = frame;
+            }
+            lastDirection = direction;
+            lastLevel = governor.level;
+        }
+    }
+
+    fprintf(verbose ? stderr : stdout, "frames %u budget %u over budget %u level changes %u bounces %u final level %d: %s\n",
+        frames, budget, overBudget, changes, bounces, governor.level, bounces ? "oscillating" : "converged");
+    return bounces ? 1 : 0;
+}
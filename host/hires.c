@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <string.h>
+#include "hires.h"
+
+bool InitHiresTarget(HiresTarget* target, u32 width, u32 height, u32 tileShift)
+{
+    memset(target, 0, sizeof(HiresTarget));
+    if (width == 0 || height == 0 || width > HIRESMAXWIDTH || height > HIRESMAXHEIGHT || tileShift > 8)
+    {
+        return false;
+    }
+
+    target->width = width;
+    target->height = height;
+    target->tileShift = tileShift;
+    target->tilesWide = (width + (1<<tileShift) - 1)>>tileShift;
+    target->tilesHigh = (height + (1<<tileShift) - 1)>>tileShift;
+    target->pixels = malloc(width*height*sizeof(u16));
+    target->points = malloc(PARTICLECOUNT*sizeof(s32));
+    target->plotTiles = malloc(PARTICLECOUNT*sizeof(u32));
+    target->plots = malloc(PARTICLECOUNT*sizeof(u32));
+    target->binned = malloc(PARTICLECOUNT*sizeof(u32));
+    target->tileStarts = malloc((target->tilesWide*target->tilesHigh + 1)*sizeof(u32));
+    if (!target->pixels || !target->points || !target->plotTiles || !target->plots || !target->binned || !target->tileStarts)
+    {
+        FreeHiresTarget(target);
+        return false;
+    }
+    ClearHiresTarget(target);
+    return true;
+}
+
+void FreeHiresTarget(HiresTarget* target)
+{
+    free(target->pixels);
+    free(target->points);
+    free(target->plotTiles);
+    free(target->plots);
+    free(target->binned);
+    free(target->tileStarts);
+    memset(target, 0, sizeof(HiresTarget));
+}
+
+void ClearHiresTarget(HiresTarget* target)
+{
+    memset(target->pixels, 0, target->width*target->height*sizeof(u16));
+}
+
+// Both renderers project the same points with the same scale, so they can only
+// differ in the order the stores land
+#define HIRESSETUP \
+    const u32 width = target->width; \
+    const u32 height = target->height; \
+    const s32 scale = view->scaleMul*(s32)height/SCREENHEIGHT; \
+    const s32 xBias = view->xPan*(s32)height/SCREENHEIGHT + (s32)(width>>1); \
+    const s32 yBias = view->yPan*(s32)height/SCREENHEIGHT + (s32)(height>>1); \
+    const s32* point = target->points; \
+    ComputeCurvePoints(view, 0, view->curves, target->points); \
+
+#define HIRESPROJECT \
+    const s32 x = (s16)*point; \
+    const s32 y = *point++>>16; \
+    const s32 pX = ((x * scale) >> SINTABLEPOWER) + xBias; \
+    const s32 pY = ((y * scale) >> SINTABLEPOWER) + yBias; \
+
+void RenderHiresDirect(HiresTarget* target, const View* view)
+{
+    HIRESSETUP;
+    u16* pixels = target->pixels;
+    for (u32 i = 0; i < view->curves; ++i)
+    {
+        const u16* colourPtr = ColourTable + i*(ITERATIONS/UNROLLCOUNT);
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            HIRESPROJECT;
+            if ((u32)pX < width && (u32)pY < height)
+            {
+                pixels[pY*width + pX] = colourPtr[j/UNROLLCOUNT];
+            }
+        }
+    }
+}
+
+void RenderHiresBinned(HiresTarget* target, const View* view)
+{
+    HIRESSETUP;
+    const u32 tileShift = target->tileShift;
+    const u32 tileMask = (1<<tileShift) - 1;
+    const u32 tilesWide = target->tilesWide;
+    const u32 tiles = tilesWide*target->tilesHigh;
+    u32* tileStarts = target->tileStarts;
+
+    // Pass one projects in draw order, counting each tile's plots and keeping
+    // the tile with the plot so the sort below need not project again
+    memset(tileStarts, 0, (tiles + 1)*sizeof(u32));
+    u32* tileCursor = target->plotTiles;
+    u32* plotCursor = target->plots;
+    for (u32 i = 0; i < view->curves; ++i)
+    {
+        const u16* colourPtr = ColourTable + i*(ITERATIONS/UNROLLCOUNT);
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            HIRESPROJECT;
+            if ((u32)pX < width && (u32)pY < height)
+            {
+                const u32 tile = (pY>>tileShift)*tilesWide + (pX>>tileShift);
+                *tileCursor++ = tile;
+                *plotCursor++ = ((pY&tileMask)<<tileShift | (pX&tileMask)) | ((u32)colourPtr[j/UNROLLCOUNT]<<16);
+                ++tileStarts[tile + 1];
+            }
+        }
+    }
+    const u32 count = plotCursor - target->plots;
+
+    // A stable counting sort keeps draw order within each tile, which is all
+    // last-writer-wins needs since tiles never share a pixel
+    for (u32 tile = 0; tile < tiles; ++tile)
+    {
+        tileStarts[tile + 1] += tileStarts[tile];
+    }
+    u32* binned = target->binned;
+    for (u32 i = 0; i < count; ++i)
+    {
+        binned[tileStarts[target->plotTiles[i]]++] = target->plots[i];
+    }
+
+    // Pass two: tileStarts now holds each tile's end, so the bins run back to
+    // back and the stores of one tile stay within its few cache-sized rows
+    u16* pixels = target->pixels;
+    u32 begin = 0;
+    for (u32 tile = 0; tile < tiles; ++tile)
+    {
+        u16* tileBase = pixels + ((tile/tilesWide)<<tileShift)*width + ((tile%tilesWide)<<tileShift);
+        const u32 end = tileStarts[tile];
+        for (u32 i = begin; i < end; ++i)
+        {
+            const u32 local = binned[i] & 0xffff;
+            tileBase[(local>>tileShift)*width + (local&tileMask)] = binned[i]>>16;
+        }
+        begin = end;
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef HIRES_H
+#define HIRES_H
+
+#include "render.h"
+
+#define HIRESMAXWIDTH 7680
+#define HIRESMAXHEIGHT 4320
+
+// A host render target of any size up to 8K. Scale and pan are the DS values
+// scaled by height/SCREENHEIGHT, so 256x192 matches RenderFrame exactly
+typedef struct
+{
+    u32 width;
+    u32 height;
+    u32 tileShift;
+    u32 tilesWide;
+    u32 tilesHigh;
+    u16* pixels;
+    s32* points;
+    u32* plotTiles;
+    u32* plots;
+    u32* binned;
+    u32* tileStarts;
+} HiresTarget;
+
+bool InitHiresTarget(HiresTarget* target, u32 width, u32 height, u32 tileShift);
+void FreeHiresTarget(HiresTarget* target);
+void ClearHiresTarget(HiresTarget* target);
+
+// Writes every plot straight into the target as it is projected
+void RenderHiresDirect(HiresTarget* target, const View* view);
+
+// Bins the plots into (1<<tileShift) pixel square tiles in draw order, then
+// writes the target a tile at a time so the stores stay in cache; tiles are at
+// most 256x256 so a plot's position within its tile fits in 16 bits
+void RenderHiresBinned(HiresTarget* target, const View* view);
+
+#endif
@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "hires.h"
+#include "hostutil.h"
+
+// Times direct and tile-binned scatter into high resolution targets across
+// resolutions and particle counts, requiring identical pixels from both and,
+// at 256x192, from RenderFrame
+
+static const u32 resolutions[][2] =
+{
+    { 256, 192 },
+    { 1280, 720 },
+    { 1920, 1080 },
+    { 3840, 2160 },
+    { 7680, 4320 },
+};
+#define RESOLUTIONS (sizeof(resolutions)/sizeof(resolutions[0]))
+
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: hiresbench [-n frames] [-s speed] [-z scale] [-t tileshift] [-r widthxheight]\n"
+        "  -n  frames per row (default 50)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -z  scaleMul at 192 lines, scaled up with the height (default %d)\n"
+        "  -t  log2 of the tile size in pixels (default 6)\n"
+        "  -r  a single resolution instead of the 256x192 to 7680x4320 sweep\n",
+        SCALEMUL);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 50;
+    s32 speed = 8;
+    s32 scaleMul = SCALEMUL;
+    u32 tileShift = 6;
+    u32 width = 0, height = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:z:t:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'z': scaleMul = atoi(optarg); break;
+            case 't': tileShift = atoi(optarg); break;
+            case 'r': if (sscanf(optarg, "%ux%u", &width, &height) != 2) Usage(); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    printf("iterations %d tile %dx%d\n", ITERATIONS, 1<<tileShift, 1<<tileShift);
+    printf("%-10s %10s %12s %12s %8s\n", "size", "particles", "direct ns", "binned ns", "speedup");
+
+    s32 failures = 0;
+    const u32 resCount = width ? 1 : RESOLUTIONS;
+    for (u32 res = 0; res < resCount; ++res)
+    {
+        const u32 w = width ? width : resolutions[res][0];
+        const u32 h = width ? height : resolutions[res][1];
+        HiresTarget target;
+        u16* direct = malloc(w*h*sizeof(u16));
+        if (!direct || !InitHiresTarget(&target, w, h, tileShift))
+        {
+            fprintf(stderr, "could not create a %ux%u target\n", w, h);
+            return 1;
+        }
+
+        for (u32 curves = CURVES/4 ? CURVES/4 : CURVES; curves <= CURVES; curves *= 2)
+        {
+            u64 directNs = 0;
+            u64 binnedNs = 0;
+            for (s32 frame = 0; frame < frames; ++frame)
+            {
+                View view = { frame*speed, scaleMul, 0, 0, curves, ITERATIONS };
+
+                ClearHiresTarget(&target);
+                u64 startNs = NowNs();
+                RenderHiresDirect(&target, &view);
+                directNs += NowNs() - startNs;
+                memcpy(direct, target.pixels, w*h*sizeof(u16));
+
+                ClearHiresTarget(&target);
+                startNs = NowNs();
+                RenderHiresBinned(&target, &view);
+                binnedNs += NowNs() - startNs;
+
+                if (memcmp(direct, target.pixels, w*h*sizeof(u16)))
+                {
+                    fprintf(stderr, "%ux%u frame %d curves %u: binned scatter differs\n", w, h, frame, curves);
+                    ++failures;
+                }
+                if (w == SCREENWIDTH && h == SCREENHEIGHT)
+                {
+                    memset(reference, 0, sizeof(reference));
+                    RenderFrame(reference, &view, 0, 0);
+                    if (memcmp(reference, target.pixels, sizeof(reference)))
+                    {
+                        fprintf(stderr, "frame %d curves %u: differs from RenderFrame\n", frame, curves);
+                        ++failures;
+                    }
+                }
+            }
+
+            char size[24];
+            snprintf(size, sizeof(size), "%ux%u", w, h);
+            printf("%-10s %10u %12.0f %12.0f %8.2f\n", size, curves*ITERATIONS,
+                (double)directNs/frames, (double)binnedNs/frames, (double)directNs/binnedNs);
+        }
+        FreeHiresTarget(&target);
+        free(direct);
+    }
+
+    printf("mismatches %d\n", failures);
+    return failures ? 1 : 0;
+}
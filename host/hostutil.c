@@ -0,0 +1,34 @@
+#include <time.h>
+#include "hostutil.h"
+#include "render.h"
+
+u64 NowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+u32 HashPixels(const void* pixels, u32 bytes)
+{
+    const u8* data = pixels;
+    u32 hash = 2166136261u;
+    for (u32 i = 0; i < bytes; ++i)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+u32 HashFrame(const u16* buffer)
+{
+    return HashPixels(buffer, SCREENWIDTH*SCREENHEIGHT*sizeof(u16));
+}
+
+void ResolvePalette(const u8* indices, const u16* palette, u16* out)
+{
+    for (u32 i = 0; i < SCREENWIDTH*SCREENHEIGHT; ++i)
+    {
+        out[i] = palette[indices[i]];
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef HOSTUTIL_H
+#define HOSTUTIL_H
+
+#include "platform.h"
+
+u64 NowNs();
+u32 HashPixels(const void* pixels, u32 bytes);
+u32 HashFrame(const u16* buffer);
+void ResolvePalette(const u8* indices, const u16* palette, u16* out);
+
+#endif
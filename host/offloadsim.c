@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "render.h"
+#include "offload.h"
+#include "governor.h"
+#include "hostutil.h"
+
+// Runs the ARM7 half of the offload on a second thread and checks every frame
+// against a single-threaded render; build with make tsan to run it under
+// ThreadSanitizer
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+static EraseList eraseList;
+static EraseList referenceList;
+static Offload offload;
+static u32 quit;
+
+static void* Arm7Thread(void* arg)
+{
+    u32 lastFrame = 0;
+    while (!LoadAcquire(&quit))
+    {
+        if (!OffloadWork(&offload, &lastFrame))
+        {
+            SpinPause();
+        }
+    }
+    return 0;
+}
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: offloadsim [-n frames] [-c curves] [-s speed]\n"
+        "  -n  number of frames to render (default 600)\n"
+        "  -c  curves computed by the ARM7 thread (default %d)\n"
+        "  -s  animationTime increment per frame (default 8)\n",
+        CURVES/4);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 600;
+    s32 offloadCurves = CURVES/4;
+    s32 speed = 8;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:c:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 'c': offloadCurves = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0 || offloadCurves < 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+    InitOffload(&offload);
+
+    pthread_t arm7;
+    if (pthread_create(&arm7, 0, Arm7Thread, 0))
+    {
+        fprintf(stderr, "could not start the ARM7 thread\n");
+        return 1;
+    }
+
+    // Vary the governor level too, so the split moves between frames
+    s32 failures = 0;
+    u64 offloadNs = 0;
+    u64 referenceNs = 0;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        View view = { frame*speed, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+        GovernorQuality(GOVERNORLEVELS - 1 - frame%GOVERNORLEVELS, &view);
+
+        memset(buffer, 0, sizeof(buffer));
+        memset(reference, 0, sizeof(reference));
+        u64 startNs = NowNs();
+        RenderOffloadFrame(buffer, &view, &eraseList, &offload, offloadCurves);
+        u64 midNs = NowNs();
+        RenderFrame(reference, &view, &referenceList, 0);
+        u64 endNs = NowNs();
+        offloadNs += midNs - startNs;
+        referenceNs += endNs - midNs;
+
+        if (memcmp(buffer, reference, sizeof(buffer)) || eraseList.count != referenceList.count ||
+            memcmp(eraseList.offsets, referenceList.offsets, eraseList.count*sizeof(u16)))
+        {
+            fprintf(stderr, "frame %d time %d curves %u: offloaded frame differs\n", frame, view.animationTime, view.curves);
+            ++failures;
+        }
+    }
+
+    StoreRelease(&quit, 1);
+    pthread_join(arm7, 0);
+
+    printf("frames %d offloaded curves %d mismatches %d\n", frames, offloadCurves, failures);
+    printf("ns/frame offloaded %.0f single %.0f\n", (double)offloadNs/frames, (double)referenceNs/frames);
+    return failures ? 1 : 0;
+}
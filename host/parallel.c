@@ -0,0 +1,99 @@
+#include <stdlib.h>
+#include "parallel.h"
+#include "simd.h"
+
+static void ChunkTask(void* context, u32 chunk, u32 worker)
+{
+    ParallelRenderer* renderer = (ParallelRenderer*)context;
+    const View* view = renderer->view;
+    const u32 firstCurve = chunk*renderer->chunkCurves;
+    const u32 curves = view->curves - firstCurve < renderer->chunkCurves ? view->curves - firstCurve : renderer->chunkCurves;
+    u32* plots = renderer->plots + firstCurve*view->iterations;
+    u32* binned = renderer->binned + firstCurve*view->iterations;
+    u32* bandStarts = renderer->bandStarts + chunk*(renderer->bands + 1);
+    if (renderer->bands == 1)
+    {
+        bandStarts[0] = 0;
+        bandStarts[1] = ProjectCurvesSimd(renderer->simdLevel, view, firstCurve, curves, binned);
+        return;
+    }
+    const u32 count = ProjectCurvesSimd(renderer->simdLevel, view, firstCurve, curves, plots);
+
+    // A stable counting sort by band; offsets are row*SCREENWIDTH + column
+    for (u32 band = 0; band <= renderer->bands; ++band)
+    {
+        bandStarts[band] = 0;
+    }
+    for (u32 i = 0; i < count; ++i)
+    {
+        ++bandStarts[renderer->rowBands[(plots[i] & 0xffff)/SCREENWIDTH] + 1];
+    }
+    for (u32 band = 1; band <= renderer->bands; ++band)
+    {
+        bandStarts[band] += bandStarts[band - 1];
+    }
+    u32 cursors[SCREENHEIGHT];
+    for (u32 band = 0; band < renderer->bands; ++band)
+    {
+        cursors[band] = bandStarts[band];
+    }
+    for (u32 i = 0; i < count; ++i)
+    {
+        binned[cursors[renderer->rowBands[(plots[i] & 0xffff)/SCREENWIDTH]]++] = plots[i];
+    }
+}
+
+static void BandTask(void* context, u32 band, u32 worker)
+{
+    ParallelRenderer* renderer = (ParallelRenderer*)context;
+    const View* view = renderer->view;
+    u16* buffer = renderer->buffer;
+    for (u32 chunk = 0; chunk < renderer->chunks; ++chunk)
+    {
+        const u32* binned = renderer->binned + chunk*renderer->chunkCurves*view->iterations;
+        const u32* bandStarts = renderer->bandStarts + chunk*(renderer->bands + 1);
+        const u32* plot = binned + bandStarts[band];
+        const u32* end = binned + bandStarts[band + 1];
+        while (plot != end)
+        {
+            buffer[*plot & 0xffff] = *plot>>16;
+            ++plot;
+        }
+    }
+}
+
+// Bands are whole rows, band b covering rows b*SCREENHEIGHT/bands onwards
+void InitParallelRenderer(ParallelRenderer* renderer, Pool* pool, u32 chunkCurves, u32 bands)
+{
+    renderer->pool = pool;
+    renderer->chunkCurves = chunkCurves < 1 ? 1 : chunkCurves;
+    renderer->bands = bands < 1 ? 1 : bands > SCREENHEIGHT ? SCREENHEIGHT : bands;
+    renderer->chunks = 0;
+    renderer->simdLevel = SimdLevel();
+    renderer->plots = (u32*)malloc(PARTICLECOUNT*sizeof(u32));
+    renderer->binned = (u32*)malloc(PARTICLECOUNT*sizeof(u32));
+    renderer->bandStarts = (u32*)malloc((CURVES + renderer->chunkCurves - 1)/renderer->chunkCurves*(renderer->bands + 1)*sizeof(u32));
+    for (u32 band = 0; band < renderer->bands; ++band)
+    {
+        for (u32 row = band*SCREENHEIGHT/renderer->bands; row < (band + 1)*SCREENHEIGHT/renderer->bands; ++row)
+        {
+            renderer->rowBands[row] = band;
+        }
+    }
+}
+
+void FreeParallelRenderer(ParallelRenderer* renderer)
+{
+    free(renderer->plots);
+    free(renderer->binned);
+    free(renderer->bandStarts);
+}
+
+void RenderFrameParallel(ParallelRenderer* renderer, u16* buffer, const View* view)
+{
+    renderer->view = view;
+    renderer->buffer = buffer;
+    renderer->chunks = (view->curves + renderer->chunkCurves - 1)/renderer->chunkCurves;
+    PoolRun(renderer->pool, ChunkTask, renderer, renderer->chunks);
+    PoolRun(renderer->pool, BandTask, renderer, renderer->bands);
+}
@@ -0,0 +1,30 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "render.h"
+#include "pool.h"
+
+// Renders a frame in two pool passes. Each chunk task projects chunkCurves
+// curves into its own slice of plots and sorts the slice by band, keeping draw
+// order within each band; then each band task replays its part of every slice
+// in curve order, so later curves still win and no plot is read twice
+typedef struct
+{
+    Pool* pool;
+    u32 chunkCurves;
+    u32 chunks;
+    u32 bands;
+    u32 simdLevel;
+    u32* plots;
+    u32* binned;
+    u32* bandStarts;
+    u8 rowBands[SCREENHEIGHT];
+    const View* view;
+    u16* buffer;
+} ParallelRenderer;
+
+void InitParallelRenderer(ParallelRenderer* renderer, Pool* pool, u32 chunkCurves, u32 bands);
+void FreeParallelRenderer(ParallelRenderer* renderer);
+void RenderFrameParallel(ParallelRenderer* renderer, u16* buffer, const View* view);
+
+#endif
@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "pool.h"
+#include "parallel.h"
+#include "hostutil.h"
+
+// Scaling benchmark for the parallel renderer: renders the same frames with 1 to
+// N threads, checking every frame against the single-threaded kernel. Build with
+// e.g. make CURVECOUNT=16384 for a million particles
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: parbench [-n frames] [-j threads] [-c curves] [-b bands] [-s speed]\n"
+        "  -n  frames per thread count (default 60)\n"
+        "  -j  highest thread count (default the online CPU count)\n"
+        "  -c  curves per chunk task (default 4)\n"
+        "  -b  screen bands for the merge (default one per thread)\n"
+        "  -s  animationTime increment per frame (default 8)\n");
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 60;
+    s32 maxThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    s32 chunkCurves = 4;
+    s32 bands = 0;
+    s32 speed = 8;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:j:c:b:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 'j': maxThreads = atoi(optarg); break;
+            case 'c': chunkCurves = atoi(optarg); break;
+            case 'b': bands = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0 || maxThreads <= 0 || maxThreads > POOLMAXTHREADS || chunkCurves <= 0 || bands < 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    // Single-threaded baseline, also the reference for every frame below
+    u64 baselineNs = 0;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        View view = { frame*speed, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+        memset(reference, 0, sizeof(reference));
+        u64 startNs = NowNs();
+        RenderFrame(reference, &view, 0, 0);
+        baselineNs += NowNs() - startNs;
+    }
+    printf("curves %d iterations %d particles %d\n", CURVES, ITERATIONS, PARTICLECOUNT);
+    printf("%-8s %12s %12s %8s\n", "threads", "ns/frame", "Mparticles/s", "speedup");
+    printf("%-8s %12.0f %12.1f %8.2f\n", "serial", (double)baselineNs/frames, PARTICLECOUNT*1e3*frames/baselineNs, 1.0);
+
+    for (s32 threads = 1; threads <= maxThreads; ++threads)
+    {
+        Pool pool;
+        ParallelRenderer renderer;
+        InitPool(&pool, threads);
+        InitParallelRenderer(&renderer, &pool, chunkCurves, bands ? bands : threads);
+
+        u64 totalNs = 0;
+        for (s32 frame = 0; frame < frames; ++frame)
+        {
+            View view = { frame*speed, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+            memset(buffer, 0, sizeof(buffer));
+            u64 startNs = NowNs();
+            RenderFrameParallel(&renderer, buffer, &view);
+            totalNs += NowNs() - startNs;
+
+            memset(reference, 0, sizeof(reference));
+            RenderFrame(reference, &view, 0, 0);
+            if (memcmp(buffer, reference, sizeof(buffer)))
+            {
+                fprintf(stderr, "threads %d frame %d differs from the single-threaded render\n", threads, frame);
+                return 1;
+            }
+        }
+        printf("%-8d %12.0f %12.1f %8.2f\n", threads, (double)totalNs/frames, PARTICLECOUNT*1e3*frames/totalNs, (double)baselineNs/totalNs);
+
+        FreeParallelRenderer(&renderer);
+        FreePool(&pool);
+    }
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include <stdlib.h>
+#include "pool.h"
+
+static bool PopTask(PoolQueue* queue, u32* task)
+{
+    pthread_mutex_lock(&queue->lock);
+    const bool found = queue->front != queue->back;
+    if (found)
+    {
+        *task = queue->tasks[queue->front++];
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return found;
+}
+
+static bool StealTask(Pool* pool, u32 thief, u32* task)
+{
+    for (u32 i = 1; i < pool->threads; ++i)
+    {
+        PoolQueue* queue = &pool->queues[(thief + i) % pool->threads];
+        pthread_mutex_lock(&queue->lock);
+        const bool found = queue->front != queue->back;
+        if (found)
+        {
+            *task = queue->tasks[--queue->back];
+        }
+        pthread_mutex_unlock(&queue->lock);
+        if (found)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void RunTasks(Pool* pool, u32 worker)
+{
+    u32 task;
+    while (PopTask(&pool->queues[worker], &task) || StealTask(pool, worker, &task))
+    {
+        pool->task(pool->context, task, worker);
+    }
+}
+
+static void* PoolThread(void* arg)
+{
+    PoolWorker* worker = (PoolWorker*)arg;
+    Pool* pool = worker->pool;
+    u32 generation = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true)
+    {
+        while (pool->generation == generation && !pool->quit)
+        {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->quit)
+        {
+            break;
+        }
+        generation = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        RunTasks(pool, worker->index);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0)
+        {
+            pthread_cond_signal(&pool->finish);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return 0;
+}
+
+void InitPool(Pool* pool, u32 threads)
+{
+    pool->threads = threads < 1 ? 1 : threads > POOLMAXTHREADS ? POOLMAXTHREADS : threads;
+    pool->capacity = 0;
+    pool->generation = 0;
+    pool->busy = 0;
+    pool->quit = false;
+    pthread_mutex_init(&pool->lock, 0);
+    pthread_cond_init(&pool->start, 0);
+    pthread_cond_init(&pool->finish, 0);
+    for (u32 i = 0; i < pool->threads; ++i)
+    {
+        pthread_mutex_init(&pool->queues[i].lock, 0);
+        pool->queues[i].tasks = 0;
+        pool->queues[i].front = pool->queues[i].back = 0;
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+    }
+    for (u32 i = 1; i < pool->threads; ++i)
+    {
+        pthread_create(&pool->handles[i], 0, PoolThread, &pool->workers[i]);
+    }
+}
+
+void FreePool(Pool* pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (u32 i = 1; i < pool->threads; ++i)
+    {
+        pthread_join(pool->handles[i], 0);
+    }
+    for (u32 i = 0; i < pool->threads; ++i)
+    {
+        pthread_mutex_destroy(&pool->queues[i].lock);
+        free(pool->queues[i].tasks);
+    }
+    pthread_cond_destroy(&pool->finish);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+void PoolRun(Pool* pool, PoolTask task, void* context, u32 tasks)
+{
+    if (tasks > pool->capacity)
+    {
+        for (u32 i = 0; i < pool->threads; ++i)
+        {
+            pool->queues[i].tasks = (u32*)realloc(pool->queues[i].tasks, tasks*sizeof(u32));
+        }
+        pool->capacity = tasks;
+    }
+
+    // Seed each queue with a contiguous run so neighbouring tasks share a worker
+    for (u32 i = 0; i < pool->threads; ++i)
+    {
+        PoolQueue* queue = &pool->queues[i];
+        const u32 first = (u64)tasks*i/pool->threads;
+        const u32 last = (u64)tasks*(i + 1)/pool->threads;
+        for (u32 j = first; j < last; ++j)
+        {
+            queue->tasks[j - first] = j;
+        }
+        queue->front = 0;
+        queue->back = last - first;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->context = context;
+    pool->busy = pool->threads - 1;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    RunTasks(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->busy)
+    {
+        pthread_cond_wait(&pool->finish, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,52 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include "platform.h"
+
+#define POOLMAXTHREADS 64
+
+// Runs task(context, index, worker) for every index in [0, tasks)
+typedef void (*PoolTask)(void* context, u32 task, u32 worker);
+
+// Each worker owns a queue seeded with a contiguous run of tasks, works through
+// it from the front and steals from the back of the others' queues when empty
+typedef struct
+{
+    pthread_mutex_t lock;
+    u32* tasks;
+    u32 front;
+    u32 back;
+} PoolQueue;
+
+struct Pool;
+
+typedef struct
+{
+    struct Pool* pool;
+    u32 index;
+} PoolWorker;
+
+typedef struct Pool
+{
+    u32 threads;
+    u32 capacity;
+    pthread_t handles[POOLMAXTHREADS];
+    PoolWorker workers[POOLMAXTHREADS];
+    PoolQueue queues[POOLMAXTHREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t finish;
+    u32 generation;
+    u32 busy;
+    bool quit;
+    PoolTask task;
+    void* context;
+} Pool;
+
+// The calling thread is worker 0, so a pool of one thread runs tasks inline
+void InitPool(Pool* pool, u32 threads);
+void FreePool(Pool* pool);
+void PoolRun(Pool* pool, PoolTask task, void* context, u32 tasks);
+
+#endif
@@ -0,0 +1,406 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include "render.h"
+#include "sinlayout.h"
+#include "hostutil.h"
+
+// Regression suite: renders a fixed set of cases, compares each hash with the
+// checked-in golden file and each cost with a budget recorded on this machine.
+// Costs are user-space instructions where perf counters are available and the
+// fastest of several timed runs otherwise. A missing budget fails rather than
+// being recorded, so a slowdown cannot slip in unchecked after a fresh checkout
+// or a make clean
+
+#if SINLAYOUT == SINLAYOUTPACKED
+#define SINCOS SINCOSPACKED
+#elif SINLAYOUT == SINLAYOUTWAVE16
+#define SINCOS SINCOSWAVE16
+#else
+#define SinTable compactsintable
+#define SINCOS SINCOSQUARTER
+#endif
+
+#define KINDFRAME 0
+#define KINDFRAME8 1
+#define KINDTRAILS 2
+#define KINDTABLES 3
+#define KINDCACHED 4
+#define KINDERASE 5
+#define KINDERASE8 6
+#define KINDFADE 7
+
+#define SEQUENCEFRAMES 16
+
+typedef struct
+{
+    const char* name;
+    u32 kind;
+    s32 animationTime;
+    s32 scaleMul;
+    s32 xPan;
+    s32 yPan;
+} RegressCase;
+
+static const RegressCase cases[] =
+{
+    { "tables", KINDTABLES, 0, 0, 0, 0 },
+    { "start", KINDFRAME, 0, SCALEMUL, 0, 0 },
+    { "moving", KINDFRAME, 4776, SCALEMUL, 0, 0 },
+    { "slowframe", KINDFRAME, 21989, SCALEMUL, 0, 0 },
+    { "deepzoom", KINDFRAME, 1000, 8101, 0, 0 },
+    { "zoomout", KINDFRAME, 1000, 64, 0, 0 },
+    { "mirrored", KINDFRAME, 1000, -SCALEMUL, 0, 0 },
+    { "panned", KINDFRAME, 3000, SCALEMUL, 100, -80 },
+    { "offscreen", KINDFRAME, 3000, 2000, -900, 700 },
+    { "start8", KINDFRAME8, 0, SCALEMUL, 0, 0 },
+    { "slowframe8", KINDFRAME8, 21989, SCALEMUL, 0, 0 },
+    { "trails", KINDTRAILS, 1000, SCALEMUL, 0, 0 },
+    { "trailszoom", KINDTRAILS, 21989, 1200, 40, 20 },
+    { "offcache", KINDCACHED, 3000, SCALEMUL, 2000, 0 },
+    { "cachezoom", KINDCACHED, 3000, 1200, 100, -80 },
+    { "erase", KINDERASE, 1000, SCALEMUL, 0, 0 },
+    { "erasezoom", KINDERASE, 21989, 1200, 40, 20 },
+    { "erase8zoom", KINDERASE8, 21989, 1200, 40, 20 },
+    { "fade", KINDFADE, 1000, 1200, 40, 20 },
+};
+#define CASES (sizeof(cases)/sizeof(cases[0]))
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u8 buffer8[SCREENWIDTH*SCREENHEIGHT];
+static PointCache pointCache;
+static EraseList eraseList;
+static FadeState fadeState;
+static u16 fadePalette[PALETTESIZE];
+static u32 goldenHashes[CASES];
+static bool goldenKnown[CASES];
+static u64 budgets[CASES];
+static bool budgetKnown[CASES];
+static u64 costs[CASES];
+static u32 hashes[CASES];
+
+static u32 HashWords(u32 hash, const void* data, u32 bytes)
+{
+    return (hash ^ HashPixels(data, bytes)) * 16777619u;
+}
+
+// The tables case rebuilds and costs the tables the frames use, looking sin and
+// cos up through the build's own layout
+static u32 RunCase(const RegressCase* c)
+{
+    if (c->kind == KINDTABLES)
+    {
+        ExpandSinTable();
+        InitColourTable();
+        InitPalette();
+        u32 hash = 2166136261u;
+        for (s32 angle = 0; angle < SINTABLEENTRIES; ++angle)
+        {
+            s32 sinCos[2];
+            SINCOS(SinTable, angle, sinCos[0], sinCos[1]);
+            hash = HashWords(hash, sinCos, sizeof(sinCos));
+        }
+        hash = HashWords(hash, ColourTable, sizeof(ColourTable));
+        hash = HashWords(hash, ColourIndexTable, sizeof(ColourIndexTable));
+        hash = HashWords(hash, FadeIndexTable, sizeof(FadeIndexTable));
+        return HashWords(hash, Palette, sizeof(Palette));
+    }
+
+    View view = { c->animationTime, c->scaleMul, c->xPan, c->yPan, CURVES, ITERATIONS };
+    if (c->kind == KINDFRAME8)
+    {
+        memset(buffer8, 0, sizeof(buffer8));
+        RenderFrame8(buffer8, &view, 0, 0);
+        return HashPixels(buffer8, sizeof(buffer8));
+    }
+
+    // A run of frames each erased through the last one's list, as on hardware
+    if (c->kind == KINDERASE8)
+    {
+        memset(buffer8, 0, sizeof(buffer8));
+        InvalidateEraseList(&eraseList);
+        for (u32 frame = 0; frame < SEQUENCEFRAMES; ++frame)
+        {
+            EraseFrame8(buffer8, &eraseList);
+            RenderFrame8(buffer8, &view, &eraseList, 0);
+            view.animationTime += 8;
+        }
+        return HashPixels(buffer8, sizeof(buffer8));
+    }
+    if (c->kind == KINDFADE)
+    {
+        InitFade(buffer8, &fadeState);
+        for (u32 frame = 0; frame < SEQUENCEFRAMES; ++frame)
+        {
+            RenderFadeFrame(buffer8, &view, &fadeState);
+            view.animationTime += 8;
+        }
+        FadePalette(&fadeState, fadePalette);
+        return HashWords(HashPixels(buffer8, sizeof(buffer8)), fadePalette, sizeof(fadePalette));
+    }
+
+    // Fills the point cache at the case's view, then plots the cache recentred
+    if (c->kind == KINDCACHED)
+    {
+        memset(buffer, 0, sizeof(buffer));
+        RenderFrame(buffer, &view, 0, &pointCache);
+        u32 hash = HashFrame(buffer);
+        view.xPan = view.yPan = 0;
+        memset(buffer, 0, sizeof(buffer));
+        PlotCachedFrame(buffer, &view, 0, &pointCache);
+        return HashWords(hash, buffer, sizeof(buffer));
+    }
+
+    memset(buffer, 0, sizeof(buffer));
+    InvalidateEraseList(&eraseList);
+    const bool erasing = c->kind == KINDERASE;
+    const u32 frames = c->kind == KINDFRAME ? 1 : SEQUENCEFRAMES;
+    for (u32 frame = 0; frame < frames; ++frame)
+    {
+        if (erasing)
+        {
+            EraseFrame(buffer, &eraseList);
+        }
+        RenderFrame(buffer, &view, erasing ? &eraseList : 0, 0);
+        view.animationTime += 8;
+    }
+    return HashFrame(buffer);
+}
+
+static int OpenInstructionCounter()
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static u64 MeasureCase(const RegressCase* c, int counter, s32 repeats, u32* hash)
+{
+    u64 best = ~0ull;
+    for (s32 repeat = 0; repeat < repeats; ++repeat)
+    {
+        u64 cost;
+        if (counter >= 0)
+        {
+            ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+            ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+            *hash = RunCase(c);
+            ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(counter, &cost, sizeof(cost)) != sizeof(cost))
+            {
+                cost = ~0ull;
+            }
+        }
+        else
+        {
+            const u64 startNs = NowNs();
+            *hash = RunCase(c);
+            cost = NowNs() - startNs;
+        }
+        best = cost < best ? cost : best;
+    }
+    return best;
+}
+
+static s32 FindCase(const char* name)
+{
+    for (u32 i = 0; i < CASES; ++i)
+    {
+        if (!strcmp(name, cases[i].name))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Every layout renders the same frames, so only the budget is keyed on it
+static void ConfigLine(char* line, u32 size, bool costs)
+{
+    static const char* layouts[] = { "packed", "wave16", "quarter" };
+    snprintf(line, size, "config curves %d iterations %d sinpower %d%s%s\n", CURVES, ITERATIONS, SINTABLEPOWER,
+        costs ? " layout " : "", costs ? layouts[SINLAYOUT] : "");
+}
+
+// Returns false if the file is missing or was written for another config or
+// cost unit; lines for unknown cases are ignored
+static bool LoadValues(const char* path, const char* unit, u64* values, bool* known)
+{
+    FILE* file = fopen(path, "r");
+    if (!file)
+    {
+        return false;
+    }
+    char config[96], line[128];
+    ConfigLine(config, sizeof(config), unit);
+    bool ok = fgets(line, sizeof(line), file) && !strcmp(line, config);
+    if (ok && unit)
+    {
+        ok = fgets(line, sizeof(line), file) && !strncmp(line, unit, strlen(unit)) && line[strlen(unit)] == '\n';
+    }
+    char name[64];
+    unsigned long long value;
+    while (ok && fgets(line, sizeof(line), file))
+    {
+        if (line[0] != '#' && sscanf(line, "%63s %lli", name, &value) == 2)
+        {
+            const s32 index = FindCase(name);
+            if (index >= 0)
+            {
+                values[index] = value;
+                known[index] = true;
+            }
+        }
+    }
+    fclose(file);
+    return ok;
+}
+
+static bool SaveValues(const char* path, const char* unit, const u64* values, bool hex)
+{
+    FILE* file = fopen(path, "w");
+    if (!file)
+    {
+        return false;
+    }
+    char config[96];
+    ConfigLine(config, sizeof(config), unit);
+    fputs(config, file);
+    if (unit)
+    {
+        fprintf(file, "%s\n", unit);
+    }
+    for (u32 i = 0; i < CASES; ++i)
+    {
+        fprintf(file, hex ? "%-12s 0x%08llx\n" : "%-12s %llu\n", cases[i].name, (unsigned long long)values[i]);
+    }
+    return fclose(file) == 0;
+}
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: regress [-g golden] [-b budget] [-u] [-B] [-t percent] [-r repeats]\n"
+        "  -g  golden hash file (default golden.txt)\n"
+        "  -b  cost budget file, recorded with -B (default budget.txt)\n"
+        "  -u  rewrite the golden hashes instead of checking them\n"
+        "  -B  rewrite the cost budget instead of checking it\n"
+        "  -t  allowed cost regression in percent (default 2 for instructions, 15 for time)\n"
+        "  -r  runs per case, keeping the cheapest (default 5)\n");
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    const char* goldenPath = "golden.txt";
+    const char* budgetPath = "budget.txt";
+    bool updateGolden = false;
+    bool updateBudget = false;
+    s32 threshold = -1;
+    s32 repeats = 5;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "g:b:uBt:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'g': goldenPath = optarg; break;
+            case 'b': budgetPath = optarg; break;
+            case 'u': updateGolden = true; break;
+            case 'B': updateBudget = true; break;
+            case 't': threshold = atoi(optarg); break;
+            case 'r': repeats = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (repeats <= 0)
+    {
+        Usage();
+    }
+
+    const int counter = OpenInstructionCounter();
+    const char* unit = counter >= 0 ? "unit instructions" : "unit ns";
+    if (threshold < 0)
+    {
+        threshold = counter >= 0 ? 2 : 15;
+    }
+
+    u64 golden[CASES] = { 0 };
+    if (!updateGolden && !LoadValues(goldenPath, 0, golden, goldenKnown))
+    {
+        fprintf(stderr, "%s is missing or not for this config, rebuild with the defaults or use -u\n", goldenPath);
+        return 1;
+    }
+    for (u32 i = 0; i < CASES; ++i)
+    {
+        goldenHashes[i] = golden[i];
+    }
+    ExpandSinTable();
+    InitColourTable();
+    InitPalette();
+    const bool haveBudget = !updateBudget && LoadValues(budgetPath, unit, budgets, budgetKnown);
+
+    s32 failures = 0;
+    if (!updateBudget && !haveBudget)
+    {
+        fprintf(stderr, "%s is missing or not for this config and cost unit; record it on a known good tree "
+            "with make regress-baseline (regress -B)\n", budgetPath);
+        ++failures;
+    }
+    printf("%-12s %8s %8s %14s %14s %8s\n", "case", "hash", "golden", unit + 5, "budget", "change");
+    for (u32 i = 0; i < CASES; ++i)
+    {
+        costs[i] = MeasureCase(&cases[i], counter, repeats, &hashes[i]);
+
+        const bool hashOk = updateGolden || (goldenKnown[i] && hashes[i] == goldenHashes[i]);
+        const bool costKnown = haveBudget && budgetKnown[i];
+        const double change = costKnown ? 100.0*((double)costs[i] - (double)budgets[i])/budgets[i] : 0.0;
+        // A case the budget has no line for is unchecked, so it fails too
+        const bool costOk = !haveBudget || (costKnown && change <= threshold);
+        failures += !hashOk + !costOk;
+
+        char goldenText[16] = "-", budgetText[24] = "-", changeText[16] = "-";
+        if (goldenKnown[i]) snprintf(goldenText, sizeof(goldenText), "%08x", goldenHashes[i]);
+        if (costKnown) snprintf(budgetText, sizeof(budgetText), "%llu", (unsigned long long)budgets[i]);
+        if (costKnown) snprintf(changeText, sizeof(changeText), "%+.1f%%", change);
+        printf("%-12s %08x %8s %14llu %14s %8s%s%s\n", cases[i].name, hashes[i], goldenText,
+            (unsigned long long)costs[i], budgetText, changeText, hashOk ? "" : "  HASH", costOk ? "" : "  COST");
+    }
+
+    if (updateGolden)
+    {
+        u64 values[CASES];
+        for (u32 i = 0; i < CASES; ++i)
+        {
+            values[i] = hashes[i];
+        }
+        if (!SaveValues(goldenPath, 0, values, true))
+        {
+            fprintf(stderr, "could not write %s\n", goldenPath);
+            return 1;
+        }
+        printf("wrote %s\n", goldenPath);
+    }
+    if (updateBudget)
+    {
+        if (!SaveValues(budgetPath, unit, costs, false))
+        {
+            fprintf(stderr, "could not write %s\n", budgetPath);
+            return 1;
+        }
+        printf("recorded the cost budget in %s\n", budgetPath);
+    }
+
+    printf("%s: %d failures, costs in %s, threshold %d%%\n", failures ? "FAIL" : "PASS", failures, unit + 5, threshold);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "governor.h"
+#include "input.h"
+#include "hostutil.h"
+
+// Drives the renderer from the checked-in camera paths or a log recorded on
+// hardware, exactly as the main loop would, and reports frame costs plus a hash
+// over every frame so runs can be compared
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static EraseList eraseList;
+static InputLog inputLog;
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: replay [-l] [-p path|file] [-q level] [-r repeats] [-v]\n"
+        "  -l  list the camera paths\n"
+        "  -p  replay one camera path by name, or an input log file (default all paths)\n"
+        "  -q  governor level (default %d, full quality)\n"
+        "  -r  replays per path, keeping each frame's fastest time (default 3)\n"
+        "  -v  print every frame's view and time\n",
+        GOVERNORLEVELS-1);
+    exit(1);
+}
+
+static void ReplayPath(const CameraPath* path, s32 level, s32 repeats, bool verbose)
+{
+    u64 totalNs = 0, maxNs = 0;
+    u32 frames = 0, slowestFrame = 0;
+    u32 hash = 0;
+    Camera camera;
+    for (s32 repeat = 0; repeat < repeats; ++repeat)
+    {
+        InputReplay replay;
+        InputRun input;
+        StartReplay(&replay, path, &camera);
+        InvalidateEraseList(&eraseList);
+        memset(buffer, 0, sizeof(buffer));
+        u64 repeatNs = 0, repeatMaxNs = 0;
+        u32 frame = 0, repeatSlowest = 0;
+        hash = 2166136261u;
+        while (NextInput(&replay, &input))
+        {
+            AdvanceCamera(&camera, input.vblanks);
+            View view = { camera.animationTime, camera.scaleMul, camera.xPan, camera.yPan, 0, 0 };
+            GovernorQuality(level, &view);
+
+            const u64 startNs = NowNs();
+            EraseFrame(buffer, &eraseList);
+            RenderFrame(buffer, &view, &eraseList, 0);
+            const u64 frameNs = NowNs() - startNs;
+
+            repeatNs += frameNs;
+            if (frameNs > repeatMaxNs)
+            {
+                repeatMaxNs = frameNs;
+                repeatSlowest = frame;
+            }
+            hash = (hash ^ HashFrame(buffer)) * 16777619u;
+            if (verbose && repeat == 0)
+            {
+                printf("  %5u time %6d scale %5d pan %5d %5d ns %8llu\n", frame, view.animationTime, view.scaleMul,
+                    view.xPan, view.yPan, (unsigned long long)frameNs);
+            }
+            UpdateCamera(&camera, &input);
+            ++frame;
+        }
+        frames = frame;
+        if (repeat == 0 || repeatNs < totalNs)
+        {
+            totalNs = repeatNs;
+            maxNs = repeatMaxNs;
+            slowestFrame = repeatSlowest;
+        }
+    }
+
+    printf("%-10s %6u %10.3f %10.0f %10.0f %6u  %08x\n", path->name, frames, totalNs*1e-6,
+        frames ? (double)totalNs/frames : 0.0, (double)maxNs, slowestFrame, hash);
+}
+
+int main(int argc, char** argv)
+{
+    const char* name = 0;
+    s32 level = GOVERNORLEVELS-1;
+    s32 repeats = 3;
+    bool verbose = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "lp:q:r:v")) != -1)
+    {
+        switch (opt)
+        {
+            case 'l':
+                for (u32 i = 0; i < CAMERAPATHS; ++i)
+                {
+                    printf("%s\n", CameraPaths[i].name);
+                }
+                return 0;
+            case 'p': name = optarg; break;
+            case 'q': level = atoi(optarg); break;
+            case 'r': repeats = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            default: Usage();
+        }
+    }
+    if (level < 0 || level >= GOVERNORLEVELS || repeats <= 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    printf("%-10s %6s %10s %10s %10s %6s  %s\n", "path", "frames", "total ms", "mean ns", "max ns", "slowest", "hash");
+    if (!name)
+    {
+        for (u32 i = 0; i < CAMERAPATHS; ++i)
+        {
+            ReplayPath(&CameraPaths[i], level, repeats, verbose);
+        }
+        return 0;
+    }
+    for (u32 i = 0; i < CAMERAPATHS; ++i)
+    {
+        if (!strcmp(name, CameraPaths[i].name))
+        {
+            ReplayPath(&CameraPaths[i], level, repeats, verbose);
+            return 0;
+        }
+    }
+    if (!LoadInputLog(&inputLog, name))
+    {
+        fprintf(stderr, "%s is neither a camera path nor an input log\n", name);
+        return 1;
+    }
+    CameraPath path;
+    InputLogPath(&inputLog, name, &path);
+    ReplayPath(&path, level, repeats, verbose);
+    return 0;
+}
@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "render.h"
+#include "hires.h"
+#include "framering.h"
+#include "hostutil.h"
+
+// One producer rendering into the shared-memory frame ring as fast as it can
+// and several consumers, each with its own mapping, following the latest frame
+// and hashing it in place. Reports the producer's frame rate alone and with the
+// consumers attached, and per consumer the frames read, skipped and torn and
+// the publish to read latency. With -v every intact read is checked against a
+// fresh render of that frame into a cleared buffer, so slot reuse is covered
+
+#define RINGTESTNAME "/bubbleuniverse-ringtest"
+#define RINGTESTMAXCONSUMERS 16
+
+typedef struct
+{
+    u32 width;
+    u32 height;
+    u32 slots;
+    s32 frames;
+    s32 speed;
+    bool verify;
+    u32* hashes;
+    u32 done;
+} RingTest;
+
+typedef struct
+{
+    RingTest* test;
+    pthread_t thread;
+    u32 seen;
+    u32 skipped;
+    u32 torn;
+    u32 mismatches;
+    u64* latencies;
+} Consumer;
+
+static EraseList eraseLists[FRAMERINGMAXSLOTS];
+
+static void Produce(RingTest* test, FrameRing* ring, double* fps)
+{
+    const bool native = test->width == SCREENWIDTH && test->height == SCREENHEIGHT;
+    HiresTarget target;
+    u16* ownPixels = 0;
+    if (!native)
+    {
+        InitHiresTarget(&target, test->width, test->height, 6);
+        ownPixels = target.pixels;
+    }
+    memset(eraseLists, 0, sizeof(eraseLists));
+
+    View view = { 0, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+    const u64 startNs = NowNs();
+    for (s32 frame = 0; frame < test->frames; ++frame)
+    {
+        const u32 slot = RingFrameSlot(ring);
+        u16* pixels = BeginRingFrame(ring);
+        if (native)
+        {
+            EraseFrame(pixels, &eraseLists[slot]);
+            RenderFrame(pixels, &view, &eraseLists[slot], 0);
+        }
+        else
+        {
+            target.pixels = pixels;
+            ClearHiresTarget(&target);
+            RenderHiresDirect(&target, &view);
+        }
+        EndRingFrame(ring);
+        view.animationTime += test->speed;
+    }
+    *fps = test->frames*1e9/(NowNs() - startNs);
+    StoreRelease(&test->done, 1);
+
+    if (!native)
+    {
+        target.pixels = ownPixels;
+        FreeHiresTarget(&target);
+    }
+}
+
+static void* ConsumerThread(void* arg)
+{
+    Consumer* consumer = arg;
+    RingTest* test = consumer->test;
+    FrameRing ring;
+    if (!OpenFrameRing(&ring, RINGTESTNAME))
+    {
+        return 0;
+    }
+
+    const u32 bytes = test->width*test->height*sizeof(u16);
+    u64 lastFrame = ~0ull;
+    for (;;)
+    {
+        const bool done = LoadAcquire(&test->done);
+        RingFrame frame;
+        if (!AcquireLatestFrame(&ring, &frame) || frame.frame == lastFrame)
+        {
+            if (done)
+            {
+                break;
+            }
+            SpinPause();
+            continue;
+        }
+
+        const u64 latencyNs = NowNs() - frame.timeNs;
+        const u32 hash = HashPixels(frame.pixels, bytes);
+        if (!RingFrameIntact(&ring, &frame))
+        {
+            ++consumer->torn;
+            continue;
+        }
+
+        if (lastFrame != ~0ull)
+        {
+            consumer->skipped += frame.frame - lastFrame - 1;
+        }
+        lastFrame = frame.frame;
+        consumer->latencies[consumer->seen++] = latencyNs;
+        if (test->verify && hash != test->hashes[frame.frame])
+        {
+            ++consumer->mismatches;
+        }
+    }
+    CloseFrameRing(&ring);
+    return 0;
+}
+
+static int CompareU64(const void* a, const void* b)
+{
+    const u64 left = *(const u64*)a, right = *(const u64*)b;
+    return left < right ? -1 : left > right;
+}
+
+static bool RunRing(RingTest* test, Consumer* consumers, s32 consumerCount, double* fps)
+{
+    FrameRing ring;
+    if (!CreateFrameRing(&ring, RINGTESTNAME, test->width, test->height, test->slots))
+    {
+        fprintf(stderr, "could not create the %ux%u ring\n", test->width, test->height);
+        return false;
+    }
+    test->done = 0;
+    for (s32 i = 0; i < consumerCount; ++i)
+    {
+        Consumer* consumer = &consumers[i];
+        consumer->test = test;
+        if (pthread_create(&consumer->thread, 0, ConsumerThread, consumer))
+        {
+            fprintf(stderr, "could not start consumer %d\n", i);
+            return false;
+        }
+    }
+
+    Produce(test, &ring, fps);
+    for (s32 i = 0; i < consumerCount; ++i)
+    {
+        pthread_join(consumers[i].thread, 0);
+    }
+    CloseFrameRing(&ring);
+    return true;
+}
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: ringtest [-c consumers] [-n frames] [-r widthxheight] [-k slots] [-s speed] [-v]\n"
+        "  -c  consumer threads (default 3, at most %d)\n"
+        "  -n  frames per run (default 600)\n"
+        "  -r  frame size (default %dx%d)\n"
+        "  -k  slots in the ring (default 4)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -v  check every intact read against a fresh render of that frame\n",
+        RINGTESTMAXCONSUMERS, SCREENWIDTH, SCREENHEIGHT);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    RingTest test = { SCREENWIDTH, SCREENHEIGHT, 4, 600, 8, false, 0, 0 };
+    s32 consumerCount = 3;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:n:r:k:s:v")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': consumerCount = atoi(optarg); break;
+            case 'n': test.frames = atoi(optarg); break;
+            case 'r': if (sscanf(optarg, "%ux%u", &test.width, &test.height) != 2) Usage(); break;
+            case 'k': test.slots = atoi(optarg); break;
+            case 's': test.speed = atoi(optarg); break;
+            case 'v': test.verify = true; break;
+            default: Usage();
+        }
+    }
+    if (consumerCount < 0 || consumerCount > RINGTESTMAXCONSUMERS || test.frames <= 0 ||
+        test.slots < 2 || test.slots > FRAMERINGMAXSLOTS || !test.width || test.width > HIRESMAXWIDTH ||
+        !test.height || test.height > HIRESMAXHEIGHT)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    Consumer consumers[RINGTESTMAXCONSUMERS];
+    memset(consumers, 0, sizeof(consumers));
+    test.hashes = calloc(test.frames, sizeof(u32));
+    for (s32 i = 0; i < consumerCount; ++i)
+    {
+        consumers[i].latencies = malloc(test.frames*sizeof(u64));
+    }
+
+    // The reference for each frame is rendered from scratch, as export does
+    if (test.verify)
+    {
+        HiresTarget target;
+        if (!InitHiresTarget(&target, test.width, test.height, 6))
+        {
+            fprintf(stderr, "could not allocate a %ux%u target\n", test.width, test.height);
+            return 1;
+        }
+        View view = { 0, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+        for (s32 frame = 0; frame < test.frames; ++frame)
+        {
+            ClearHiresTarget(&target);
+            RenderHiresDirect(&target, &view);
+            test.hashes[frame] = HashPixels(target.pixels, test.width*test.height*sizeof(u16));
+            view.animationTime += test.speed;
+        }
+        FreeHiresTarget(&target);
+    }
+
+    double aloneFps, sharedFps;
+    if (!RunRing(&test, consumers, 0, &aloneFps) || !RunRing(&test, consumers, consumerCount, &sharedFps))
+    {
+        return 1;
+    }
+
+    printf("frames %d %ux%u slots %u consumers %d\n", test.frames, test.width, test.height, test.slots, consumerCount);
+    printf("producer fps alone %.1f with consumers %.1f\n", aloneFps, sharedFps);
+    u32 failures = 0;
+    for (s32 i = 0; i < consumerCount; ++i)
+    {
+        Consumer* consumer = &consumers[i];
+        printf("consumer %d read %u skipped %u torn %u", i, consumer->seen, consumer->skipped, consumer->torn);
+        if (test.verify)
+        {
+            printf(" mismatches %u", consumer->mismatches);
+            failures += consumer->mismatches;
+        }
+        if (consumer->seen)
+        {
+            u64* latencies = consumer->latencies;
+            qsort(latencies, consumer->seen, sizeof(u64), CompareU64);
+            printf(" latency us p50 %.1f p99 %.1f max %.1f",
+                latencies[consumer->seen/2]/1e3, latencies[consumer->seen*99/100]/1e3, latencies[consumer->seen - 1]/1e3);
+        }
+        printf("\n");
+    }
+    return failures ? 1 : 0;
+}
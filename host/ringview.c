@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "framering.h"
+#include "hostutil.h"
+
+// Sample reader for the frame ring written by stream: follows the latest frame
+// without ever blocking the producer, hashing each one in place, and reports
+// frames seen, skipped and torn plus the latency from publish to read. With -o
+// it also converts each frame to RGB24, as a raw stream or the last one as a PPM
+
+static inline u8 Expand5(u32 value)
+{
+    return (value<<3) | (value>>2);
+}
+
+static void ConvertFrame(const u16* pixels, u32 count, u8* bytes)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        const u16 colour = pixels[i];
+        *bytes++ = Expand5(colour & 31);
+        *bytes++ = Expand5((colour>>5) & 31);
+        *bytes++ = Expand5((colour>>10) & 31);
+    }
+}
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: ringview [-m name] [-n frames] [-o file] [-f ppm|rgb] [-p usec] [-w seconds] [-v]\n"
+        "  -m  shared memory name (default %s)\n"
+        "  -n  stop after this many frames, 0 to follow the producer (default 0)\n"
+        "  -o  write frames as RGB24 to a file, - for stdout\n"
+        "  -f  the last frame as a PPM or every frame as raw RGB24 (default ppm)\n"
+        "  -p  poll interval while no new frame is ready (default 500)\n"
+        "  -w  give up after this long without a new frame (default 2)\n"
+        "  -v  print every frame's number, hash and latency\n",
+        FRAMERINGNAME);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    const char* name = FRAMERINGNAME;
+    const char* path = 0;
+    bool ppm = true;
+    s32 frames = 0;
+    s32 pollUsec = 500;
+    s32 waitSeconds = 2;
+    bool verbose = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "m:n:o:f:p:w:v")) != -1)
+    {
+        switch (opt)
+        {
+            case 'm': name = optarg; break;
+            case 'n': frames = atoi(optarg); break;
+            case 'o': path = optarg; break;
+            case 'f':
+                if (!strcmp(optarg, "ppm")) ppm = true;
+                else if (!strcmp(optarg, "rgb")) ppm = false;
+                else Usage();
+                break;
+            case 'p': pollUsec = atoi(optarg); break;
+            case 'w': waitSeconds = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            default: Usage();
+        }
+    }
+    if (frames < 0 || pollUsec < 0 || waitSeconds <= 0)
+    {
+        Usage();
+    }
+
+    FrameRing ring;
+    u64 waitNs = NowNs() + waitSeconds*1000000000ull;
+    while (!OpenFrameRing(&ring, name))
+    {
+        if (NowNs() > waitNs)
+        {
+            fprintf(stderr, "no frame ring %s\n", name);
+            return 1;
+        }
+        usleep(10000);
+    }
+    const u32 width = ring.header->width;
+    const u32 height = ring.header->height;
+    const u32 pixelCount = width*height;
+
+    FILE* out = 0;
+    u8* bytes = 0;
+    bool converted = false;
+    if (path)
+    {
+        out = strcmp(path, "-") ? fopen(path, "wb") : stdout;
+        bytes = malloc(3*pixelCount);
+        if (!out || !bytes)
+        {
+            fprintf(stderr, "could not open %s\n", path);
+            return 1;
+        }
+    }
+
+    s32 seen = 0;
+    u32 skipped = 0, torn = 0;
+    u64 lastFrame = ~0ull;
+    u64 totalLatencyNs = 0, maxLatencyNs = 0;
+    waitNs = NowNs() + waitSeconds*1000000000ull;
+    while (!frames || seen < frames)
+    {
+        RingFrame frame;
+        if (!AcquireLatestFrame(&ring, &frame) || frame.frame == lastFrame)
+        {
+            if (NowNs() > waitNs)
+            {
+                break;
+            }
+            usleep(pollUsec);
+            continue;
+        }
+
+        const u64 latencyNs = NowNs() - frame.timeNs;
+        const u32 hash = HashPixels(frame.pixels, pixelCount*sizeof(u16));
+        if (bytes)
+        {
+            ConvertFrame(frame.pixels, pixelCount, bytes);
+        }
+        if (!RingFrameIntact(&ring, &frame))
+        {
+            ++torn;
+            continue;
+        }
+
+        if (lastFrame != ~0ull && frame.frame > lastFrame + 1)
+        {
+            skipped += frame.frame - lastFrame - 1;
+        }
+        lastFrame = frame.frame;
+        ++seen;
+        totalLatencyNs += latencyNs;
+        maxLatencyNs = latencyNs > maxLatencyNs ? latencyNs : maxLatencyNs;
+        waitNs = NowNs() + waitSeconds*1000000000ull;
+        if (verbose)
+        {
+            printf("frame %llu hash %08x latency %.1fus\n", (unsigned long long)frame.frame, hash, latencyNs/1e3);
+        }
+        if (bytes)
+        {
+            converted = true;
+            if (!ppm)
+            {
+                fwrite(bytes, 3, pixelCount, out);
+            }
+        }
+    }
+
+    if (out)
+    {
+        if (ppm && converted)
+        {
+            fprintf(out, "P6\n%u %u\n255\n", width, height);
+            fwrite(bytes, 3, pixelCount, out);
+        }
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+    }
+    CloseFrameRing(&ring);
+
+    fprintf(stderr, "frames %d skipped %u torn %u %ux%u\n", seen, skipped, torn, width, height);
+    if (seen)
+    {
+        fprintf(stderr, "latency avg %.1fus max %.1fus\n", totalLatencyNs/1e3/seen, maxLatencyNs/1e3);
+    }
+    return 0;
+}
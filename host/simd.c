@@ -0,0 +1,161 @@
+#include "simd.h"
+
+const char* SimdNames[SIMDLEVELS] = { "scalar", "sse4.1", "avx2" };
+
+#if (defined(__x86_64__) || defined(__i386__)) && SINLAYOUT == SINLAYOUTPACKED
+
+#include <immintrin.h>
+
+// The lanes hold consecutive curves, so each iteration's offsets are stored
+// together and the plots are read back lane by lane to keep curve order.
+// Offscreen points are stored as ~0
+static u32 EmitLanes(const u32* laneOffsets, u32 lanes, u32 firstCurve, u32 iterations, u32* plots)
+{
+    u32* plotCursor = plots;
+    for (u32 lane = 0; lane < lanes; ++lane)
+    {
+        const u16* colourPtr = ColourTable + (firstCurve + lane)*(ITERATIONS/UNROLLCOUNT);
+        const u32* offset = laneOffsets + lane;
+        for (u32 j = 0; j < iterations; ++j, offset += lanes)
+        {
+            if (*offset != ~0u)
+            {
+                *plotCursor++ = *offset | ((u32)colourPtr[j/UNROLLCOUNT]<<16);
+            }
+        }
+    }
+    return plotCursor - plots;
+}
+
+__attribute__((target("avx2")))
+static u32 ProjectCurvesAvx2(const View* view, u32 firstCurve, u32 curves, u32* plots)
+{
+    u32 laneOffsets[ITERATIONS*8];
+    const __m256i mask = _mm256_set1_epi32(SINTABLEENTRIES-1);
+    const __m256i scale = _mm256_set1_epi32(view->scaleMul);
+    const __m256i xBias = _mm256_set1_epi32(view->xPan + (SCREENWIDTH>>1));
+    const __m256i yBias = _mm256_set1_epi32(view->yPan + (SCREENHEIGHT>>1));
+    const __m256i xLimit = _mm256_set1_epi32(SCREENWIDTH-1);
+    const __m256i yLimit = _mm256_set1_epi32(SCREENHEIGHT-1);
+    const __m256i offscreen = _mm256_set1_epi32(-1);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    u32* plotCursor = plots;
+    u32 curve = firstCurve;
+    for (; curve + 8 <= firstCurve + curves; curve += 8)
+    {
+        const __m256i curveIndex = _mm256_add_epi32(_mm256_set1_epi32(curve), lane);
+        const __m256i ang1Start = _mm256_add_epi32(_mm256_set1_epi32(view->animationTime), _mm256_mullo_epi32(curveIndex, _mm256_set1_epi32(ANG1INC)));
+        const __m256i ang2Start = _mm256_add_epi32(_mm256_set1_epi32(view->animationTime), _mm256_mullo_epi32(curveIndex, _mm256_set1_epi32(ANG2INC)));
+        __m256i x = _mm256_setzero_si256();
+        __m256i y = _mm256_setzero_si256();
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            const __m256i angle1 = _mm256_and_si256(_mm256_add_epi32(ang1Start, x), mask);
+            const __m256i angle2 = _mm256_and_si256(_mm256_add_epi32(ang2Start, y), mask);
+            const __m256i packed1 = _mm256_i32gather_epi32((const int*)SinTable, angle1, 4);
+            const __m256i packed2 = _mm256_i32gather_epi32((const int*)SinTable, angle2, 4);
+            x = _mm256_add_epi32(_mm256_srai_epi32(_mm256_slli_epi32(packed1, 16), 16), _mm256_srai_epi32(_mm256_slli_epi32(packed2, 16), 16));
+            y = _mm256_add_epi32(_mm256_srai_epi32(packed1, 16), _mm256_srai_epi32(packed2, 16));
+
+            const __m256i pX = _mm256_add_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(x, scale), SINTABLEPOWER), xBias);
+            const __m256i pY = _mm256_add_epi32(_mm256_srai_epi32(_mm256_mullo_epi32(y, scale), SINTABLEPOWER), yBias);
+            const __m256i onscreen = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_min_epu32(pX, xLimit), pX),
+                                                      _mm256_cmpeq_epi32(_mm256_min_epu32(pY, yLimit), pY));
+            const __m256i offset = _mm256_add_epi32(_mm256_slli_epi32(pY, 8), pX);
+            _mm256_storeu_si256((__m256i*)(laneOffsets + j*8), _mm256_blendv_epi8(offscreen, offset, onscreen));
+        }
+        plotCursor += EmitLanes(laneOffsets, 8, curve, view->iterations, plotCursor);
+    }
+    return (plotCursor - plots) + ProjectCurves(view, curve, firstCurve + curves - curve, plotCursor);
+}
+
+// SSE4.1 has no gather, so the four table reads are scalar
+__attribute__((target("sse4.1")))
+static u32 ProjectCurvesSse4(const View* view, u32 firstCurve, u32 curves, u32* plots)
+{
+    u32 laneOffsets[ITERATIONS*4];
+    const __m128i mask = _mm_set1_epi32(SINTABLEENTRIES-1);
+    const __m128i scale = _mm_set1_epi32(view->scaleMul);
+    const __m128i xBias = _mm_set1_epi32(view->xPan + (SCREENWIDTH>>1));
+    const __m128i yBias = _mm_set1_epi32(view->yPan + (SCREENHEIGHT>>1));
+    const __m128i xLimit = _mm_set1_epi32(SCREENWIDTH-1);
+    const __m128i yLimit = _mm_set1_epi32(SCREENHEIGHT-1);
+    const __m128i offscreen = _mm_set1_epi32(-1);
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+
+    u32* plotCursor = plots;
+    u32 curve = firstCurve;
+    for (; curve + 4 <= firstCurve + curves; curve += 4)
+    {
+        const __m128i curveIndex = _mm_add_epi32(_mm_set1_epi32(curve), lane);
+        const __m128i ang1Start = _mm_add_epi32(_mm_set1_epi32(view->animationTime), _mm_mullo_epi32(curveIndex, _mm_set1_epi32(ANG1INC)));
+        const __m128i ang2Start = _mm_add_epi32(_mm_set1_epi32(view->animationTime), _mm_mullo_epi32(curveIndex, _mm_set1_epi32(ANG2INC)));
+        __m128i x = _mm_setzero_si128();
+        __m128i y = _mm_setzero_si128();
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            const __m128i angle1 = _mm_and_si128(_mm_add_epi32(ang1Start, x), mask);
+            const __m128i angle2 = _mm_and_si128(_mm_add_epi32(ang2Start, y), mask);
+            const __m128i packed1 = _mm_setr_epi32(SinTable[_mm_extract_epi32(angle1, 0)], SinTable[_mm_extract_epi32(angle1, 1)],
+                                                   SinTable[_mm_extract_epi32(angle1, 2)], SinTable[_mm_extract_epi32(angle1, 3)]);
+            const __m128i packed2 = _mm_setr_epi32(SinTable[_mm_extract_epi32(angle2, 0)], SinTable[_mm_extract_epi32(angle2, 1)],
+                                                   SinTable[_mm_extract_epi32(angle2, 2)], SinTable[_mm_extract_epi32(angle2, 3)]);
+            x = _mm_add_epi32(_mm_srai_epi32(_mm_slli_epi32(packed1, 16), 16), _mm_srai_epi32(_mm_slli_epi32(packed2, 16), 16));
+            y = _mm_add_epi32(_mm_srai_epi32(packed1, 16), _mm_srai_epi32(packed2, 16));
+
+            const __m128i pX = _mm_add_epi32(_mm_srai_epi32(_mm_mullo_epi32(x, scale), SINTABLEPOWER), xBias);
+            const __m128i pY = _mm_add_epi32(_mm_srai_epi32(_mm_mullo_epi32(y, scale), SINTABLEPOWER), yBias);
+            const __m128i onscreen = _mm_and_si128(_mm_cmpeq_epi32(_mm_min_epu32(pX, xLimit), pX),
+                                                   _mm_cmpeq_epi32(_mm_min_epu32(pY, yLimit), pY));
+            const __m128i offset = _mm_add_epi32(_mm_slli_epi32(pY, 8), pX);
+            _mm_storeu_si128((__m128i*)(laneOffsets + j*4), _mm_blendv_epi8(offscreen, offset, onscreen));
+        }
+        plotCursor += EmitLanes(laneOffsets, 4, curve, view->iterations, plotCursor);
+    }
+    return (plotCursor - plots) + ProjectCurves(view, curve, firstCurve + curves - curve, plotCursor);
+}
+
+u32 SimdLevel()
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SIMDAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return SIMDSSE4;
+    }
+    return SIMDSCALAR;
+}
+
+u32 ProjectCurvesSimd(u32 level, const View* view, u32 firstCurve, u32 curves, u32* plots)
+{
+    const u32 supported = SimdLevel();
+    level = level < supported ? level : supported;
+    if (level == SIMDAVX2)
+    {
+        return ProjectCurvesAvx2(view, firstCurve, curves, plots);
+    }
+    if (level == SIMDSSE4)
+    {
+        return ProjectCurvesSse4(view, firstCurve, curves, plots);
+    }
+    return ProjectCurves(view, firstCurve, curves, plots);
+}
+
+#else
+
+// The gathers read PACKED sin/cos pairs, other layouts and CPUs use the scalar kernel
+u32 SimdLevel()
+{
+    return SIMDSCALAR;
+}
+
+u32 ProjectCurvesSimd(u32 level, const View* view, u32 firstCurve, u32 curves, u32* plots)
+{
+    return ProjectCurves(view, firstCurve, curves, plots);
+}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include "render.h"
+
+#define SIMDSCALAR 0
+#define SIMDSSE4 1
+#define SIMDAVX2 2
+#define SIMDLEVELS 3
+
+extern const char* SimdNames[SIMDLEVELS];
+
+// The best level this CPU and sin table layout support
+u32 SimdLevel();
+
+// ProjectCurves with curves stepped in lockstep across SIMD lanes, writing
+// identical plots; levels the CPU lacks fall back to the scalar kernel
+u32 ProjectCurvesSimd(u32 level, const View* view, u32 firstCurve, u32 curves, u32* plots);
+
+#endif
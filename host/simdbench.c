@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "simd.h"
+#include "hostutil.h"
+
+// Times each SIMD level this CPU supports on the same frames, requiring plots
+// identical to the scalar ProjectCurves and frames identical to RenderFrame
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+static u32 plots[PARTICLECOUNT];
+static u32 referencePlots[PARTICLECOUNT];
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: simdbench [-n frames] [-s speed] [-z scale]\n"
+        "  -n  frames per level (default 300)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -z  scaleMul (default %d)\n",
+        SCALEMUL);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 300;
+    s32 speed = 8;
+    s32 scaleMul = SCALEMUL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:z:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'z': scaleMul = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    u64 kernelNs = 0;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        View view = { frame*speed, scaleMul, 0, 0, CURVES, ITERATIONS };
+        memset(reference, 0, sizeof(reference));
+        u64 startNs = NowNs();
+        RenderFrame(reference, &view, 0, 0);
+        kernelNs += NowNs() - startNs;
+    }
+
+    printf("curves %d iterations %d particles %d\n", CURVES, ITERATIONS, PARTICLECOUNT);
+    printf("%-8s %12s %12s %10s\n", "level", "ns/frame", "Mparticles/s", "vs scalar");
+    printf("%-8s %12.0f %12.1f %10s\n", "kernel", (double)kernelNs/frames, PARTICLECOUNT*1e3*frames/kernelNs, "");
+
+    u64 scalarNs = 0;
+    for (u32 level = SIMDSCALAR; level <= SimdLevel(); ++level)
+    {
+        u64 totalNs = 0;
+        for (s32 frame = 0; frame < frames; ++frame)
+        {
+            View view = { frame*speed, scaleMul, 0, 0, CURVES, ITERATIONS };
+            memset(buffer, 0, sizeof(buffer));
+            u64 startNs = NowNs();
+            const u32 count = ProjectCurvesSimd(level, &view, 0, CURVES, plots);
+            for (u32 i = 0; i < count; ++i)
+            {
+                buffer[plots[i] & 0xffff] = plots[i]>>16;
+            }
+            totalNs += NowNs() - startNs;
+
+            memset(reference, 0, sizeof(reference));
+            RenderFrame(reference, &view, 0, 0);
+            const u32 referenceCount = ProjectCurves(&view, 0, CURVES, referencePlots);
+            if (count != referenceCount || memcmp(plots, referencePlots, count*sizeof(u32)) || memcmp(buffer, reference, sizeof(buffer)))
+            {
+                fprintf(stderr, "%s frame %d differs from the scalar kernel\n", SimdNames[level], frame);
+                return 1;
+            }
+        }
+        if (level == SIMDSCALAR)
+        {
+            scalarNs = totalNs;
+        }
+        printf("%-8s %12.0f %12.1f %10.2f\n", SimdNames[level], (double)totalNs/frames, PARTICLECOUNT*1e3*frames/totalNs, (double)scalarNs/totalNs);
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "render.h"
+#include "sinlayout.h"
+#include "hostutil.h"
+
+static s32 packedTable[SINTABLEENTRIES];
+static s16 waveTable[SINTABLEENTRIES];
+
+typedef struct
+{
+    u64 ns;
+    u64 misses;
+    u32 checksum;
+} LayoutResult;
+
+// Counts L1 data cache read misses for this thread, or returns -1 when the
+// kernel does not allow it (containers, perf_event_paranoid)
+static int OpenMissCounter()
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+#define RECURRENCE(SINCOS, table) \
+    for (s32 frame = 0; frame < frames; ++frame) \
+    { \
+        s32 ang1Start = frame*8, ang2Start = frame*8; \
+        for (u32 i = 0; i < CURVES; ++i) \
+        { \
+            s32 x = 0, y = 0; \
+            for (u32 j = 0; j < ITERATIONS; ++j) \
+            { \
+                s32 angle1 = (ang1Start + x)&(SINTABLEENTRIES-1); \
+                s32 angle2 = (ang2Start + y)&(SINTABLEENTRIES-1); \
+                s32 sin1, cos1, sin2, cos2; \
+                SINCOS(table, angle1, sin1, cos1); \
+                SINCOS(table, angle2, sin2, cos2); \
+                x = sin1 + sin2; \
+                y = cos1 + cos2; \
+                checksum = (checksum ^ ((u16)x | ((u32)y<<16))) * 16777619u; \
+            } \
+            ang1Start += ANG1INC; \
+            ang2Start += ANG2INC; \
+        } \
+    }
+
+static void Measure(int counter, s32 frames, s32 layout, LayoutResult* result)
+{
+    u32 checksum = 2166136261u;
+    u64 misses = 0;
+    if (counter >= 0)
+    {
+        ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    u64 startNs = NowNs();
+    switch (layout)
+    {
+        case SINLAYOUTPACKED: RECURRENCE(SINCOSPACKED, packedTable); break;
+        case SINLAYOUTWAVE16: RECURRENCE(SINCOSWAVE16, waveTable); break;
+        default: RECURRENCE(SINCOSQUARTER, compactsintable); break;
+    }
+    result->ns = NowNs() - startNs;
+    if (counter >= 0)
+    {
+        ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counter, &misses, sizeof(misses)) != sizeof(misses))
+        {
+            misses = 0;
+        }
+    }
+    result->misses = misses;
+    result->checksum = checksum;
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 200;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: sinbench [-n frames]\n");
+                return 1;
+        }
+    }
+
+    static const char* const names[] = { "packed", "wave16", "quarter" };
+    static const u32 bytes[] = { sizeof(packedTable), sizeof(waveTable), SINTABLEENTRIES/4*sizeof(s16) };
+    u64 expandNs[3];
+
+    u64 startNs = NowNs();
+    ExpandPackedSinTable(packedTable);
+    expandNs[SINLAYOUTPACKED] = NowNs() - startNs;
+    startNs = NowNs();
+    ExpandWaveSinTable(waveTable);
+    expandNs[SINLAYOUTWAVE16] = NowNs() - startNs;
+    expandNs[SINLAYOUTQUARTER] = 0;
+
+    int counter = OpenMissCounter();
+    printf("SINTABLEPOWER %d, %d curves x %d iterations, %d frames%s\n", SINTABLEPOWER, CURVES, ITERATIONS, frames,
+        counter < 0 ? ", cache miss counter unavailable" : "");
+    printf("%-8s %8s %10s %12s %14s %10s\n", "layout", "bytes", "expand ns", "ns/frame", "L1D miss/frame", "checksum");
+
+    u32 reference = 0;
+    bool identical = true;
+    for (s32 layout = 0; layout < 3; ++layout)
+    {
+        LayoutResult result;
+        Measure(counter, 1, layout, &result);
+        Measure(counter, frames, layout, &result);
+        if (layout == 0)
+        {
+            reference = result.checksum;
+        }
+        identical &= result.checksum == reference;
+
+        printf("%-8s %8u %10llu %12.0f ", names[layout], bytes[layout], (unsigned long long)expandNs[layout], (double)result.ns / frames);
+        if (counter < 0)
+        {
+            printf("%14s", "n/a");
+        }
+        else
+        {
+            printf("%14.0f", (double)result.misses / frames);
+        }
+        printf(" %08x\n", result.checksum);
+    }
+
+    if (counter >= 0)
+    {
+        close(counter);
+    }
+    if (!identical)
+    {
+        fprintf(stderr, "layouts disagree\n");
+        return 1;
+    }
+    return 0;
+}
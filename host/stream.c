@@ -0,0 +1,139 @@
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "render.h"
+#include "hires.h"
+#include "framering.h"
+#include "hostutil.h"
+
+// Renders straight into the slots of a shared-memory frame ring for a local
+// consumer (ringview, a compositor, an encoder) to read in place. At the DS
+// size each slot keeps its own erase list, as the triple-buffered main loop
+// does, so only last lap's particles are cleared; the lists start invalid, so
+// the first lap clears whole slots
+
+static EraseList eraseLists[FRAMERINGMAXSLOTS];
+static volatile sig_atomic_t quit;
+
+static void Quit(int signal)
+{
+    quit = 1;
+}
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: stream [-m name] [-r widthxheight] [-k slots] [-n frames] [-t time] [-s speed] [-F fps]\n"
+        "  -m  shared memory name (default %s)\n"
+        "  -r  frame size (default %dx%d)\n"
+        "  -k  slots in the ring (default 4)\n"
+        "  -n  number of frames, 0 to run until interrupted (default 0)\n"
+        "  -t  animationTime of the first frame (default 0)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -F  frame rate, 0 to render as fast as possible (default 60)\n",
+        FRAMERINGNAME, SCREENWIDTH, SCREENHEIGHT);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    const char* name = FRAMERINGNAME;
+    u32 width = SCREENWIDTH, height = SCREENHEIGHT;
+    s32 slots = 4;
+    s32 frames = 0;
+    s32 speed = 8;
+    s32 fps = 60;
+    View view = { 0, SCALEMUL, 0, 0, CURVES, ITERATIONS };
+
+    int opt;
+    while ((opt = getopt(argc, argv, "m:r:k:n:t:s:F:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'm': name = optarg; break;
+            case 'r': if (sscanf(optarg, "%ux%u", &width, &height) != 2) Usage(); break;
+            case 'k': slots = atoi(optarg); break;
+            case 'n': frames = atoi(optarg); break;
+            case 't': view.animationTime = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'F': fps = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (slots < 2 || slots > FRAMERINGMAXSLOTS || frames < 0 || fps < 0)
+    {
+        Usage();
+    }
+
+    const bool native = width == SCREENWIDTH && height == SCREENHEIGHT;
+    HiresTarget target;
+    if (!native && !InitHiresTarget(&target, width, height, 6))
+    {
+        fprintf(stderr, "could not allocate a %ux%u target\n", width, height);
+        return 1;
+    }
+
+    FrameRing ring;
+    if (!CreateFrameRing(&ring, name, width, height, slots))
+    {
+        fprintf(stderr, "could not create the %ux%u ring %s\n", width, height, name);
+        return 1;
+    }
+    signal(SIGINT, Quit);
+    signal(SIGTERM, Quit);
+
+    ExpandSinTable();
+    InitColourTable();
+
+    // The hires target's own buffer is only needed for its size; it renders
+    // into whichever slot is next
+    u16* ownPixels = native ? 0 : target.pixels;
+    const u64 startNs = NowNs();
+    u64 renderNs = 0;
+    s32 frame = 0;
+    for (; !quit && (!frames || frame < frames); ++frame)
+    {
+        const u32 slot = RingFrameSlot(&ring);
+        u16* pixels = BeginRingFrame(&ring);
+        const u64 frameNs = NowNs();
+        if (native)
+        {
+            EraseFrame(pixels, &eraseLists[slot]);
+            RenderFrame(pixels, &view, &eraseLists[slot], 0);
+        }
+        else
+        {
+            target.pixels = pixels;
+            ClearHiresTarget(&target);
+            RenderHiresDirect(&target, &view);
+        }
+        renderNs += NowNs() - frameNs;
+        EndRingFrame(&ring);
+        view.animationTime += speed;
+
+        if (fps)
+        {
+            const u64 dueNs = startNs + (u64)(frame + 1)*1000000000u/fps;
+            const struct timespec due = { dueNs/1000000000u, dueNs%1000000000u };
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, 0);
+        }
+    }
+    const u64 elapsedNs = NowNs() - startNs;
+
+    if (!native)
+    {
+        target.pixels = ownPixels;
+        FreeHiresTarget(&target);
+    }
+    CloseFrameRing(&ring);
+
+    printf("frames %d %ux%u slots %d\n", frame, width, height, slots);
+    if (frame)
+    {
+        printf("ms/frame render %.3f fps %.1f\n", renderNs/1e6/frame, frame*1e9/elapsedNs);
+    }
+    return 0;
+}
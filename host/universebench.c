@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "render.h"
+#include "hostutil.h"
+
+// Throughput of each compiled-in universe kernel, next to the general kernel at
+// this build's size. A universe the same shape as the build must match
+// RenderFrame exactly
+
+static u16 buffer[SCREENWIDTH*SCREENHEIGHT];
+static u16 reference[SCREENWIDTH*SCREENHEIGHT];
+static EraseList eraseList;
+
+static void Usage()
+{
+    fprintf(stderr,
+        "usage: universebench [-n frames] [-s speed] [-z scale]\n"
+        "  -n  frames per kernel (default 300)\n"
+        "  -s  animationTime increment per frame (default 8)\n"
+        "  -z  scaleMul (default %d)\n",
+        SCALEMUL);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    s32 frames = 300;
+    s32 speed = 8;
+    s32 scaleMul = SCALEMUL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:z:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = atoi(optarg); break;
+            case 's': speed = atoi(optarg); break;
+            case 'z': scaleMul = atoi(optarg); break;
+            default: Usage();
+        }
+    }
+    if (frames <= 0)
+    {
+        Usage();
+    }
+
+    ExpandSinTable();
+    InitColourTable();
+
+    printf("%-8s %10s %12s %12s\n", "kernel", "particles", "ns/frame", "Mparticles/s");
+    u64 generalNs = 0;
+    for (s32 frame = 0; frame < frames; ++frame)
+    {
+        View view = { frame*speed, scaleMul, 0, 0, CURVES, ITERATIONS };
+        EraseFrame(buffer, &eraseList);
+        u64 startNs = NowNs();
+        RenderFrame(buffer, &view, &eraseList, 0);
+        generalNs += NowNs() - startNs;
+    }
+    printf("%-8s %10d %12.0f %12.1f\n", "general", PARTICLECOUNT, (double)generalNs/frames, PARTICLECOUNT*1e3*frames/generalNs);
+
+    s32 failures = 0;
+    for (u32 universe = 0; universe < UNIVERSES; ++universe)
+    {
+        const Universe* info = &Universes[universe];
+        const bool matchesBuild = info->curveCount == CURVECOUNT && info->curveStep == CURVESTEP && info->iterations == ITERATIONS;
+        InvalidateEraseList(&eraseList);
+        u64 totalNs = 0;
+        for (s32 frame = 0; frame < frames; ++frame)
+        {
+            View view = { frame*speed, scaleMul, 0, 0, CURVES, ITERATIONS };
+            EraseFrame(buffer, &eraseList);
+            u64 startNs = NowNs();
+            RenderUniverseFrame(universe, buffer, &view, &eraseList);
+            totalNs += NowNs() - startNs;
+
+            if (matchesBuild)
+            {
+                memset(reference, 0, sizeof(reference));
+                RenderFrame(reference, &view, 0, 0);
+                if (memcmp(buffer, reference, sizeof(buffer)))
+                {
+                    fprintf(stderr, "%s frame %d: differs from RenderFrame\n", info->name, frame);
+                    ++failures;
+                }
+            }
+        }
+        LoadUniverseColours(-1);
+        printf("%-8s %10u %12.0f %12.1f%s\n", info->name, info->particles, (double)totalNs/frames,
+            info->particles*1e3*frames/totalNs, matchesBuild ? "  checked" : "");
+    }
+
+    printf("mismatches %d\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,64 @@
+#include "governor.h"
+
+void InitGovernor(Governor* governor, u32 budgetUsec)
+{
+    governor->budgetUsec = budgetUsec;
+    governor->level = GOVERNORLEVELS-1;
+    governor->calmFrames = 0;
+    governor->overFrames = 0;
+    governor->overUsec = 0;
+}
+
+// Levels alternate between trimming iterations and curves, from a quarter of
+// the particles at level 0 up to the full universe at the top level
+void GovernorQuality(s32 level, View* view)
+{
+    view->curves = (CURVES * ((GOVERNORLEVELS-1)/2 + level/2)) / (GOVERNORLEVELS-1);
+    view->iterations = ((ITERATIONS/UNROLLCOUNT * ((GOVERNORLEVELS-1)/2 + (level+1)/2)) / (GOVERNORLEVELS-1)) * UNROLLCOUNT;
+}
+
+static u32 LevelParticles(s32 level)
+{
+    View view;
+    GovernorQuality(level, &view);
+    return view.curves * view.iterations;
+}
+
+// After GOVERNOROVER frames over budget, drops straight to the level whose
+// predicted cost from the cheapest of those frames fits, so a lone slow frame
+// is ignored. Only climbs one level after GOVERNORSETTLE frames whose predicted
+// cost at the next level would still leave a margin, so it cannot bounce
+// between two levels
+void UpdateGovernor(Governor* governor, u32 usec)
+{
+    const u32 particles = LevelParticles(governor->level);
+    if (usec > governor->budgetUsec)
+    {
+        governor->calmFrames = 0;
+        governor->overUsec = governor->overFrames && governor->overUsec < usec ? governor->overUsec : usec;
+        if (++governor->overFrames >= GOVERNOROVER)
+        {
+            while (governor->level > 0 && (u64)governor->overUsec * LevelParticles(governor->level) > (u64)governor->budgetUsec * particles)
+            {
+                governor->level--;
+            }
+            governor->overFrames = 0;
+        }
+        return;
+    }
+
+    governor->overFrames = 0;
+    if (governor->level < GOVERNORLEVELS-1 &&
+        (u64)usec * LevelParticles(governor->level + 1) * 8 < (u64)governor->budgetUsec * particles * 7)
+    {
+        if (++governor->calmFrames >= GOVERNORSETTLE)
+        {
+            governor->level++;
+            governor->calmFrames = 0;
+        }
+    }
+    else
+    {
+        governor->calmFrames = 0;
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include "render.h"
+
+// Compute budget per frame, leaving the rest of the 16.7ms for the HUD and vblank
+#ifndef GOVERNORBUDGET
+#define GOVERNORBUDGET 15000
+#endif
+#define GOVERNORLEVELS 17
+#define GOVERNORSETTLE 30
+#define GOVERNOROVER 2
+
+typedef struct
+{
+    u32 budgetUsec;
+    s32 level;
+    s32 calmFrames;
+    s32 overFrames;
+    u32 overUsec;
+} Governor;
+
+void InitGovernor(Governor* governor, u32 budgetUsec);
+void GovernorQuality(s32 level, View* view);
+void UpdateGovernor(Governor* governor, u32 usec);
+
+#endif
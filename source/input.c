@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include "input.h"
+
+typedef struct
+{
+    u32 magic;
+    u32 version;
+    s32 animationTime;
+    s32 speed;
+    s32 oldSpeed;
+    s32 scaleMul;
+    s32 xPan;
+    s32 yPan;
+    u32 justReset;
+    u32 runCount;
+} InputLogHeader;
+
+void InitCamera(Camera* camera)
+{
+    camera->animationTime = 0;
+    camera->speed = 8;
+    camera->oldSpeed = 0;
+    camera->scaleMul = SCALEMUL;
+    camera->xPan = 0;
+    camera->yPan = 0;
+    camera->justReset = false;
+}
+
+void AdvanceCamera(Camera* camera, u32 vblanks)
+{
+    camera->animationTime += camera->speed*(s32)vblanks;
+}
+
+void UpdateCamera(Camera* camera, const InputRun* input)
+{
+    s32 pressed = input->held;
+    const s32 modSpeed = (pressed & KEY_L ? 4 : 1) + (pressed & KEY_R ? 8 : 0);
+    if (pressed & KEY_LEFT) camera->xPan += modSpeed;
+    if (pressed & KEY_RIGHT) camera->xPan -= modSpeed;
+    if (pressed & KEY_UP) camera->yPan += modSpeed;
+    if (pressed & KEY_DOWN) camera->yPan -= modSpeed;
+    if ((pressed & KEY_A) && !camera->justReset) camera->scaleMul += modSpeed;
+    if ((pressed & KEY_B) && !camera->justReset) camera->scaleMul -= modSpeed;
+    if (!(pressed & (KEY_A|KEY_B))) camera->justReset = false;
+    pressed = input->downRepeat;
+    if ((pressed & KEY_A) && (pressed & KEY_B)) { camera->scaleMul = SCALEMUL; camera->xPan = camera->yPan = 0; camera->justReset = true; }
+    if (pressed & KEY_X) camera->speed += modSpeed;
+    if (pressed & KEY_Y) camera->speed -= modSpeed;
+    pressed = input->down;
+    if (pressed & KEY_START)
+    {
+        if (camera->speed)
+        {
+            camera->oldSpeed = camera->speed;
+            camera->speed = 0;
+        }
+        else
+        {
+            camera->speed = camera->oldSpeed;
+        }
+    }
+}
+
+void InitInputLog(InputLog* log, const Camera* start)
+{
+    log->start = *start;
+    log->runCount = 0;
+}
+
+// Extends the last run when the frame matches it, returns false once full
+bool RecordInput(InputLog* log, const InputRun* input)
+{
+    if (log->runCount)
+    {
+        InputRun* last = &log->runs[log->runCount-1];
+        if (last->frames < 255 && last->held == input->held && last->down == input->down &&
+            last->downRepeat == input->downRepeat && last->vblanks == input->vblanks)
+        {
+            ++last->frames;
+            return true;
+        }
+    }
+    if (log->runCount == INPUTLOGRUNS)
+    {
+        return false;
+    }
+    InputRun* run = &log->runs[log->runCount++];
+    *run = *input;
+    run->frames = 1;
+    return true;
+}
+
+void InputLogPath(const InputLog* log, const char* name, CameraPath* path)
+{
+    path->name = name;
+    path->start = log->start;
+    path->runCount = log->runCount;
+    path->runs = log->runs;
+}
+
+bool SaveInputLog(const InputLog* log, const char* filename)
+{
+    FILE* file = fopen(filename, "wb");
+    if (!file)
+    {
+        return false;
+    }
+    const Camera* start = &log->start;
+    const InputLogHeader header = { INPUTLOGMAGIC, INPUTLOGVERSION, start->animationTime, start->speed, start->oldSpeed,
+                                    start->scaleMul, start->xPan, start->yPan, start->justReset, log->runCount };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(log->runs, sizeof(InputRun), log->runCount, file) == log->runCount;
+    return fclose(file) == 0 && ok;
+}
+
+bool LoadInputLog(InputLog* log, const char* filename)
+{
+    FILE* file = fopen(filename, "rb");
+    if (!file)
+    {
+        return false;
+    }
+    InputLogHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 && header.magic == INPUTLOGMAGIC &&
+              header.version == INPUTLOGVERSION && header.runCount <= INPUTLOGRUNS &&
+              fread(log->runs, sizeof(InputRun), header.runCount, file) == header.runCount;
+    fclose(file);
+    if (!ok)
+    {
+        log->runCount = 0;
+        return false;
+    }
+    const Camera start = { header.animationTime, header.speed, header.oldSpeed, header.scaleMul, header.xPan, header.yPan, header.justReset != 0 };
+    log->start = start;
+    log->runCount = header.runCount;
+    return true;
+}
+
+void StartReplay(InputReplay* replay, const CameraPath* path, Camera* camera)
+{
+    replay->path = path;
+    replay->run = 0;
+    replay->frame = 0;
+    *camera = path->start;
+}
+
+// Runs only merge identical frames, so every frame of one replays it verbatim;
+// returns false when the path is over
+bool NextInput(InputReplay* replay, InputRun* input)
+{
+    const CameraPath* path = replay->path;
+    if (replay->run == path->runCount)
+    {
+        return false;
+    }
+    const InputRun* run = &path->runs[replay->run];
+    *input = *run;
+    input->frames = 1;
+    if (++replay->frame == run->frames)
+    {
+        ++replay->run;
+        replay->frame = 0;
+    }
+    return true;
+}
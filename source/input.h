@@ -0,0 +1,73 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "render.h"
+
+// An input log is the starting camera plus runs of identical frames of input,
+// each with the vblanks its frame advanced the animation by, so a replay sees
+// the same views however long its own frames take
+
+#define INPUTLOGMAGIC 0x4c495542
+#define INPUTLOGVERSION 1
+#define INPUTLOGRUNS 8192
+
+typedef struct
+{
+    u16 held;
+    u16 down;
+    u16 downRepeat;
+    u8 vblanks;
+    u8 frames;
+} InputRun;
+
+typedef struct
+{
+    s32 animationTime;
+    s32 speed;
+    s32 oldSpeed;
+    s32 scaleMul;
+    s32 xPan;
+    s32 yPan;
+    bool justReset;
+} Camera;
+
+typedef struct
+{
+    const char* name;
+    Camera start;
+    u32 runCount;
+    const InputRun* runs;
+} CameraPath;
+
+typedef struct
+{
+    Camera start;
+    u32 runCount;
+    InputRun runs[INPUTLOGRUNS];
+} InputLog;
+
+typedef struct
+{
+    const CameraPath* path;
+    u32 run;
+    u32 frame;
+} InputReplay;
+
+// The checked-in benchmark scenarios, in paths.c
+#define CAMERAPATHS 3
+extern const CameraPath CameraPaths[CAMERAPATHS];
+
+void InitCamera(Camera* camera);
+void AdvanceCamera(Camera* camera, u32 vblanks);
+void UpdateCamera(Camera* camera, const InputRun* input);
+
+void InitInputLog(InputLog* log, const Camera* start);
+bool RecordInput(InputLog* log, const InputRun* input);
+void InputLogPath(const InputLog* log, const char* name, CameraPath* path);
+bool SaveInputLog(const InputLog* log, const char* filename);
+bool LoadInputLog(InputLog* log, const char* filename);
+
+void StartReplay(InputReplay* replay, const CameraPath* path, Camera* camera);
+bool NextInput(InputReplay* replay, InputRun* input);
+
+#endif
@@ -0,0 +1,147 @@
+@---------------------------------------------------------------------------------
+@ Hand-scheduled ARMv5TE version of RenderCurves for the 16bpp, PACKED layout,
+@ erase-list path (see render.c, which stays the reference and the fallback)
+@
+@ u16* RenderCurvesArm(const ArmKernelArgs* args) returns the erase cursor
+@
+@ - the next point's sin table loads are issued before the current point is
+@   projected, hiding their latency behind the multiplies and the plot
+@ - angles are kept pre-shifted so masking to the table is the load's own lsr
+@ - SMULWB with scaleMul<<2 gives (x*scaleMul)>>14 in one multiply
+@ - the pans are biased by half the screen so each axis clips with a single
+@   unsigned compare, and the plot is conditionally executed rather than branched
+@---------------------------------------------------------------------------------
+#ifdef ARMKERNEL
+
+#ifndef SINTABLEPOWER
+#define SINTABLEPOWER 14
+#endif
+#define ANGLESHIFT (32-SINTABLEPOWER)
+#define LOOKUPSHIFT (30-SINTABLEPOWER)
+
+@ ArmKernelArgs, keep in step with render.c
+#define ARGBUFFER 0
+#define ARGSINTABLE 4
+#define ARGCOLOURS 8
+#define ARGERASE 12
+#define ARGSCALE 16
+#define ARGXBIAS 20
+#define ARGYBIAS 24
+#define ARGANGSTART 28
+#define ARGANG1INC 32
+#define ARGANG2INC 36
+#define ARGCURVES 40
+#define ARGGROUPS 44
+#define ARGSKIPPED 48
+
+@ stack frame
+#define SPANG1INC 0
+#define SPANG2INC 4
+#define SPCURVES 8
+#define SPGROUPBYTES 12
+#define SPSKIPBYTES 16
+#define SPGROUPEND 20
+#define FRAMESIZE 24
+
+@ r0 x, r1 y, r2/r3 next sin/cos pairs, r4/r5 shifted curve angles,
+@ r6 SinTable, r7 scaleMul<<2, r8/r9 biased pans, r10 buffer,
+@ r11 erase cursor, r12 colour, lr colour pointer
+
+    .macro NEXTXY
+    mov     r0, r2, lsl #16
+    add     r0, r0, r3, lsl #16
+    mov     r0, r0, asr #16
+    mov     r1, r2, asr #16
+    add     r1, r1, r3, asr #16
+    .endm
+
+    .macro STEP
+    add     r2, r4, r0, lsl #ANGLESHIFT
+    add     r3, r5, r1, lsl #ANGLESHIFT
+    ldr     r2, [r6, r2, lsr #LOOKUPSHIFT]
+    ldr     r3, [r6, r3, lsr #LOOKUPSHIFT]
+    smulwb  r0, r0, r7
+    smulwb  r1, r1, r7
+    add     r0, r0, r8
+    add     r1, r1, r9
+    cmp     r0, #256
+    cmplo   r1, #192
+    addlo   r1, r0, r1, lsl #8
+    addlo   r0, r10, r1, lsl #1
+    strhlo  r12, [r0]
+    strhlo  r1, [r11], #2
+    NEXTXY
+    .endm
+
+    .syntax unified
+    .arm
+    .section .itcm,"ax",%progbits
+    .align  2
+    .global RenderCurvesArm
+    .type   RenderCurvesArm, %function
+RenderCurvesArm:
+    push    {r4-r11, lr}
+    sub     sp, sp, #FRAMESIZE
+
+    ldr     r1, [r0, #ARGANG1INC]
+    ldr     r2, [r0, #ARGANG2INC]
+    mov     r1, r1, lsl #ANGLESHIFT
+    mov     r2, r2, lsl #ANGLESHIFT
+    str     r1, [sp, #SPANG1INC]
+    str     r2, [sp, #SPANG2INC]
+    ldr     r1, [r0, #ARGCURVES]
+    ldr     r2, [r0, #ARGGROUPS]
+    ldr     r3, [r0, #ARGSKIPPED]
+    str     r1, [sp, #SPCURVES]
+    mov     r2, r2, lsl #1
+    mov     r3, r3, lsl #1
+    str     r2, [sp, #SPGROUPBYTES]
+    str     r3, [sp, #SPSKIPBYTES]
+
+    ldr     r4, [r0, #ARGANGSTART]
+    ldr     r6, [r0, #ARGSINTABLE]
+    ldr     r7, [r0, #ARGSCALE]
+    ldr     r8, [r0, #ARGXBIAS]
+    ldr     r9, [r0, #ARGYBIAS]
+    ldr     r10, [r0, #ARGBUFFER]
+    ldr     r11, [r0, #ARGERASE]
+    ldr     lr, [r0, #ARGCOLOURS]
+    mov     r4, r4, lsl #ANGLESHIFT
+    mov     r5, r4
+
+curveLoop:
+    @ the first point of each curve starts from x = y = 0
+    ldr     r2, [r6, r4, lsr #LOOKUPSHIFT]
+    ldr     r3, [r6, r5, lsr #LOOKUPSHIFT]
+    ldr     r12, [sp, #SPGROUPBYTES]
+    add     r12, lr, r12
+    str     r12, [sp, #SPGROUPEND]
+    NEXTXY
+
+groupLoop:
+    ldrh    r12, [lr], #2
+    STEP
+    STEP
+    STEP
+    STEP
+    ldr     r2, [sp, #SPGROUPEND]
+    cmp     lr, r2
+    blo     groupLoop
+
+    ldr     r2, [sp, #SPSKIPBYTES]
+    ldr     r3, [sp, #SPANG1INC]
+    add     lr, lr, r2
+    ldr     r2, [sp, #SPANG2INC]
+    add     r4, r4, r3
+    add     r5, r5, r2
+    ldr     r2, [sp, #SPCURVES]
+    subs    r2, r2, #1
+    str     r2, [sp, #SPCURVES]
+    bne     curveLoop
+
+    mov     r0, r11
+    add     sp, sp, #FRAMESIZE
+    pop     {r4-r11, pc}
+    .size   RenderCurvesArm, .-RenderCurvesArm
+
+#endif
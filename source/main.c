@@ -1,73 +1,98 @@
 #include <nds.h>
+#include <fat.h>
 #include <stdio.h>
-#include "sintable.h"
+#include <string.h>
+#include "render.h"
+#include "governor.h"
+#include "profiler.h"
+#include "input.h"
+#ifdef OFFLOAD
+#include "offload.h"
+#endif
 
 #include "font.h"
 
-#define CURVECOUNT 256
-#define CURVESTEP 4
-#define ITERATIONS 256
-#define SIZE 96
-#define SCREENWIDTH 256
-#define SCREENHEIGHT 192
-#define PI 3.1415926535897932384626433832795
-#define SINTABLEPOWER 14
-#define SINTABLEENTRIES (1<<SINTABLEPOWER)
-#define ANG1INC (s32)((CURVESTEP * SINTABLEENTRIES) / 235)
-#define ANG2INC (s32)((CURVESTEP * SINTABLEENTRIES) / (2*PI))
-#define SCALEMUL (s32)(SIZE*PI)
-
 #define PRINTCHAR(x) *textCursor++ = (x)-32
 #define PRINTDIGIT(x) *textCursor++ = (x)+16
 
-#define UNROLLCOUNT 4
+#ifndef PALETTED
+#define PALETTED false
+#endif
 
-bool trails = false;
-s32 speed = 8;
-s32 oldSpeed = 0;
-bool justReset = false;
-s32 scaleMul = SCALEMUL;
-s32 xPan = 0;
-s32 yPan = 0;
+#define PANSCROLLLIMIT 16
+#define PROFILEREFRESH 8
+#define PRESENTBUFFERS 3
+#define MAPBASEBYTES 0x4000
+#define BUFFERROWS 256
+#define INPUTLOGFILE "/bubbles.inp"
+#define INPUTSTATUSWIDTH 19
 
+#if defined(OFFLOAD) && SINTABLEINDTCM
+#error "OFFLOAD needs the sin table in main RAM where the ARM7 can read it"
+#endif
 
-s32 SinTable[SINTABLEENTRIES];
-DTCM_BSS u16 ColourTable[ITERATIONS*CURVECOUNT/CURVESTEP/UNROLLCOUNT];
+bool trails = false;
+bool paletted = PALETTED;
+bool fading = false;
+s32 universe = -1;
+Camera camera;
+
+EraseList eraseLists[PRESENTBUFFERS];
+FadeState fadeState;
+PointCache pointCache;
+Governor governor;
+Profiler profiler;
+u32 phaseStart;
+
+// R+Select records the input to INPUTLOGFILE, R+Start steps through replays of
+// the camera paths and then the recording. The display mode is not logged, so
+// a replay starts from whichever mode is showing
+InputLog inputLog;
+CameraPath recordedPath;
+InputReplay replay;
+bool fatReady = false;
+bool recording = false;
+bool replaying = false;
+bool inputSaved = false;
+s32 replayIndex = -1;
+u32 replayFrames = 0;
+u32 replayUsec = 0;
+#ifdef OFFLOAD
+Offload offloadShared;
+Offload* offload;
+#endif
+
+int bgId;
+void* buffers[PRESENTBUFFERS];
+u32 mapBases[PRESENTBUFFERS];
+
+// Presentation state shared with the vblank handler, which shows the queued
+// buffer if one is ready and otherwise repeats the current one
+volatile s32 shownBuffer = 0;
+volatile s32 queuedBuffer = -1;
+volatile s32 queuedXScroll = 0;
+volatile s32 queuedYScroll = 0;
+volatile bool rendering = false;
+volatile u32 vblankCount = 0;
+volatile u32 droppedFrames = 0;
+volatile u32 duplicatedFrames = 0;
+s32 presentedBuffer = -1;
+s32 presentedXScroll = 0;
+s32 presentedYScroll = 0;
 
 PrintConsole* console;
 u16* textBase;
 u16* textCursor;
+u16* particlesCursorPos;
 u16* speedCursorPos;
 u16* statsCursorPos;
 u16* vsyncCursorPos;
-
-void ExpandSinTable()
-{
-    for (int i = 0; i < SINTABLEENTRIES/4; ++i)
-    {
-        SinTable[i] = SinTable[SINTABLEENTRIES/2 - i - 1] = compactsintable[i];
-        SinTable[SINTABLEENTRIES/2 + i] = SinTable[SINTABLEENTRIES - i - 1] = -compactsintable[i];
-    }
-    for (int i = 0; i < SINTABLEENTRIES; ++i)
-    {
-        *((s16*)(SinTable+i)+1) = *(s16*)(SinTable+((i+SINTABLEENTRIES/4)%SINTABLEENTRIES));
-    }
-}
-
-void InitColourTable()
-{
-    int colourIndex = 0;
-    for (int i = 0; i < CURVECOUNT; i += CURVESTEP)
-    {
-        const s32 red = (i >> 3)|BIT(15);
-        for (int j = 0; j < ITERATIONS; j += UNROLLCOUNT)
-        {
-            const s32 green = j >> 3;
-            const s32 blue = (62-(red+green))>>1;
-            ColourTable[colourIndex++] = red + (green<<5) + (blue<<10);
-        }
-    }
-}
+u16* presentCursorPos;
+u16* inputCursorPos;
+// Cache line aligned, as it is invalidated before the DMA that saves the page
+u16 helpPage[32*24] __attribute__((aligned(32)));
+bool profilePage = false;
+u32 profileRefresh = 0;
 
 void InitConsole()
 {
@@ -113,27 +138,329 @@ void printNumber(s32 number)
     }
 }
 
-#define UNROLL \
-    values1 = SinTable[(ang1Start + x)&(SINTABLEENTRIES-1)]; \
-    values2 = SinTable[(ang2Start + y)&(SINTABLEENTRIES-1)]; \
-    x = (s32)(s16)values1 + (s32)(s16)values2; \
-    y = (values1>>16) + (values2>>16); \
-    pX = ((x * scaleMul) >> SINTABLEPOWER) + xPan; \
-    pY = ((y * scaleMul) >> SINTABLEPOWER) + yPan; \
-    if (pX >= -(SCREENWIDTH>>1) && pY >= -(SCREENHEIGHT>>1) && pX < (SCREENWIDTH>>1) && pY < (SCREENHEIGHT>>1)) \
-    { \
-        screenCentre[pY*SCREENWIDTH + pX] = *colourPtr; \
-    } \
+void printPadded(s32 number, s32 width)
+{
+    s32 digits = number < 0 ? 2 : 1;
+    for (s32 n = number < 0 ? -number : number; n >= 10; n /= 10)
+    {
+        digits++;
+    }
+    for (; digits < width; ++digits)
+    {
+        PRINTCHAR(' ');
+    }
+    printNumber(number);
+}
+
+void printText(const char* text, s32 width)
+{
+    for (; *text; ++text, --width)
+    {
+        PRINTCHAR(*text);
+    }
+    for (; width > 0; --width)
+    {
+        PRINTCHAR(' ');
+    }
+}
+
+void printStats(const PhaseStats* stats)
+{
+    printPadded(stats->min, 6);
+    printPadded(stats->avg, 6);
+    printPadded(stats->p95, 6);
+    printPadded(stats->max, 6);
+}
+
+void DrawProfilePage()
+{
+    PhaseStats stats;
+    for (u32 phase = 0; phase < PHASECOUNT; ++phase)
+    {
+        textCursor = textBase + 32*(5 + phase) + 1;
+        printText(PhaseNames[phase], 7);
+        ProfilerStats(&profiler, phase, &stats);
+        printStats(&stats);
+    }
+    textCursor = textBase + 32*(6 + PHASECOUNT) + 1;
+    printText("Frame", 7);
+    ProfilerFrameStats(&profiler, &stats);
+    printStats(&stats);
+}
+
+void ShowProfilePage(bool show)
+{
+    profilePage = show;
+    if (show)
+    {
+        FillWords(0, textBase, sizeof(helpPage));
+        textCursor = textBase + 32*1 + 1;
+        printText("Last 64 frames (usec)", 0);
+        textCursor = textBase + 32*3 + 1;
+        printText("Phase     min   avg   p95   max", 0);
+        textCursor = textBase + 32*22 + 1;
+        printText("Touch : Back to help", 0);
+        DrawProfilePage();
+    }
+    else
+    {
+        DC_FlushRange(helpPage, sizeof(helpPage));
+        dmaCopy(helpPage, textBase, sizeof(helpPage));
+    }
+}
+
+void DrawInputStatus()
+{
+    u16* end = inputCursorPos + INPUTSTATUSWIDTH;
+    textCursor = inputCursorPos;
+    if (recording)
+    {
+        printText("Rec ", 0);
+        printNumber(inputLog.runCount);
+        printText(" runs", 0);
+    }
+    else if (replaying)
+    {
+        printText(replay.path->name, 0);
+        PRINTCHAR(' ');
+        printNumber(replayFrames);
+    }
+    else if (replayIndex >= 0)
+    {
+        printText(replay.path->name, 0);
+        PRINTCHAR(' ');
+        printNumber(replayUsec/1000); PRINTCHAR('m'); PRINTCHAR('s');
+    }
+    else if (inputLog.runCount)
+    {
+        printText(inputSaved ? "Saved " : "Unsaved ", 0);
+        printNumber(inputLog.runCount);
+        printText(" runs", 0);
+    }
+    while (textCursor < end)
+    {
+        PRINTCHAR(' ');
+    }
+}
+
+void ToggleRecording()
+{
+    if (recording)
+    {
+        recording = false;
+        inputSaved = fatReady && SaveInputLog(&inputLog, INPUTLOGFILE);
+    }
+    else if (!replaying)
+    {
+        InitInputLog(&inputLog, &camera);
+        recording = true;
+        replayIndex = -1;
+    }
+}
+
+// Steps to the next camera path, then the recording if there is one, then off
+void NextReplay()
+{
+    if (recording)
+    {
+        return;
+    }
+    const s32 paths = CAMERAPATHS + (inputLog.runCount ? 1 : 0);
+    replaying = ++replayIndex < paths;
+    if (!replaying)
+    {
+        replayIndex = -1;
+        return;
+    }
+    const CameraPath* path = &CameraPaths[replayIndex];
+    if (replayIndex == CAMERAPATHS)
+    {
+        InputLogPath(&inputLog, "recorded", &recordedPath);
+        path = &recordedPath;
+    }
+    StartReplay(&replay, path, &camera);
+    replayFrames = 0;
+    replayUsec = 0;
+    InitProfiler(&profiler);
+}
+
+void EndPhase(u32 phase)
+{
+    u32 now = cpuGetTiming();
+    ProfilerRecord(&profiler, phase, timerTicks2usec(now - phaseStart));
+    phaseStart = now;
+}
+
+void PresentVBlank()
+{
+    ++vblankCount;
+    if (queuedBuffer >= 0)
+    {
+        shownBuffer = queuedBuffer;
+        queuedBuffer = -1;
+        bgSetMapBase(bgId, mapBases[shownBuffer]);
+        bgSetScroll(bgId, queuedXScroll, queuedYScroll);
+        bgUpdate();
+
+        // The bitmap wraps horizontally, so columns scrolled in from the other
+        // edge are windowed out to the backdrop; rows below the frame are clear
+        if (queuedXScroll)
+        {
+            windowSetBounds(WINDOW_0, queuedXScroll < 0 ? -queuedXScroll : 0, 0,
+                            queuedXScroll > 0 ? SCREENWIDTH - queuedXScroll : 0, SCREENHEIGHT);
+            windowEnable(WINDOW_0);
+        }
+        else
+        {
+            windowDisable(WINDOW_0);
+        }
+    }
+    else if (rendering)
+    {
+        ++duplicatedFrames;
+    }
+}
+
+// Queues a buffer for the next vblank, a finished frame that never reached the
+// screen is dropped in favour of the newer one
+void Present(s32 buffer, s32 xScroll, s32 yScroll)
+{
+    if (buffer == presentedBuffer && xScroll == presentedXScroll && yScroll == presentedYScroll)
+    {
+        return;
+    }
+    const int oldIME = enterCriticalSection();
+    if (queuedBuffer >= 0 && queuedBuffer != buffer)
+    {
+        ++droppedFrames;
+    }
+    queuedBuffer = buffer;
+    queuedXScroll = xScroll;
+    queuedYScroll = yScroll;
+    leaveCriticalSection(oldIME);
+    presentedBuffer = buffer;
+    presentedXScroll = xScroll;
+    presentedYScroll = yScroll;
+}
+
+// A buffer that is neither on screen nor waiting for the next vblank
+s32 FreeBuffer()
+{
+    const int oldIME = enterCriticalSection();
+    s32 buffer = 0;
+    while (buffer == shownBuffer || buffer == queuedBuffer)
+    {
+        ++buffer;
+    }
+    leaveCriticalSection(oldIME);
+    return buffer;
+}
+
+// The CPU builds the palette in cached main RAM, so it has to reach memory
+// before the DMA reads it
+void LoadPalette()
+{
+    DC_FlushRange(Palette, sizeof(Palette));
+    dmaCopy(Palette, BG_PALETTE, sizeof(Palette));
+}
+
+// Three 256x256 buffers: banks A, B and D for 16bpp, or three 64KB slots across
+// banks A and B for 8bpp. The rows below the frame are only ever seen while a
+// pan scrolls the last frame, so they are cleared once here
+void InitDisplay()
+{
+    const int oldIME = enterCriticalSection();
+    vramSetBankB(VRAM_B_MAIN_BG_0x06020000);
+    if (paletted)
+    {
+        vramSetBankD(VRAM_D_LCD);
+        bgId = bgInit(3, BgType_Bmp8, BgSize_B8_256x256, 0, 0);
+        LoadPalette();
+        for (s32 i = 0; i < PRESENTBUFFERS; ++i)
+        {
+            mapBases[i] = i*4;
+        }
+    }
+    else
+    {
+        vramSetBankD(VRAM_D_MAIN_BG_0x06040000);
+        bgId = bgInit(3, BgType_Bmp16, BgSize_B16_256x256, 0, 0);
+        BG_PALETTE[0] = 0;
+        for (s32 i = 0; i < PRESENTBUFFERS; ++i)
+        {
+            mapBases[i] = i*8;
+        }
+    }
+    bgWindowEnable(bgId, WINDOW_0);
+    windowDisable(WINDOW_0);
+    shownBuffer = 0;
+    queuedBuffer = -1;
+    presentedBuffer = 0;
+    presentedXScroll = presentedYScroll = 0;
+    leaveCriticalSection(oldIME);
+
+    for (s32 i = 0; i < PRESENTBUFFERS; ++i)
+    {
+        buffers[i] = (u8*)bgGetGfxPtr(bgId) + mapBases[i]*MAPBASEBYTES;
+        FillWords(0, buffers[i], SCREENWIDTH*BUFFERROWS*(paletted ? 1 : 2));
+        InvalidateEraseList(&eraseLists[i]);
+    }
+}
+
+// Only live frames are offloaded, the point cache is filled by the ARM9 alone
+void RenderLiveFrame(void* buffer, const View* view, EraseList* eraseList, PointCache* cache)
+{
+#ifdef OFFLOAD
+    if (!cache)
+    {
+        if (paletted)
+        {
+            RenderOffloadFrame8(buffer, view, eraseList, offload, OFFLOADCURVES);
+        }
+        else
+        {
+            RenderOffloadFrame(buffer, view, eraseList, offload, OFFLOADCURVES);
+        }
+        return;
+    }
+#endif
+    if (paletted)
+    {
+        RenderFrame8(buffer, view, eraseList, cache);
+    }
+    else
+    {
+        RenderFrame(buffer, view, eraseList, cache);
+    }
+}
 
 int main(void)
 {
+    InitCamera(&camera);
     ExpandSinTable();
     InitColourTable();
+    InitPalette();
+#ifdef OFFLOAD
+    // The ARM7 reads the sin table from main RAM and both CPUs use the offload
+    // block through the uncached mirror
+    DC_FlushAll();
+    DC_InvalidateRange(&offloadShared, sizeof(Offload));
+    offload = (Offload*)memUncached(&offloadShared);
+    InitOffload(offload);
+    fifoSendAddress(FIFO_USER_01, offload);
+#endif
     InitConsole();
+    fatReady = fatInitDefault();
+    if (fatReady)
+    {
+        inputSaved = LoadInputLog(&inputLog, INPUTLOGFILE);
+    }
 
 	videoSetMode(MODE_5_2D); 
     vramSetBankA(VRAM_A_MAIN_BG_0x06000000);
-    vramSetBankB(VRAM_B_MAIN_BG_0x06020000);
+    InitDisplay();
+    irqSet(IRQ_VBLANK, PresentVBlank);
+    irqEnable(IRQ_VBLANK);
 
     keysSetRepeat(16, 1);
 
@@ -150,113 +477,279 @@ int main(void)
         "       X/Y : Speed inc/dec\n"
         "       L/R : Fast move + zoom\n"
         "     Start : Pause/Unpause\n"
-        "    Select : Toggle trails\n"
-        "\n\n"
+        "    Select : Cycle trails/fade\n"
+        "  L+Select : Toggle 8bpp\n"
+        "     Touch : Toggle profiler\n"
+        " R+Sel/Sta : Record/Replay\n"
+        "   L+Start : Universe size\n"
         " Particles : %d\n"
         "     Speed : %ld\n"
-        "\n"
         "     Frame :\n"
         "     Vsync :\n"
-        "\n\n"
+        "  Drop/Dup :\n"
+        "     Input :\n"
         "        By Movie Vertigo\n"
         "    youtube.com/movievertigo\n"
         "    twitter.com/movievertigo",
-        ITERATIONS * CURVECOUNT / CURVESTEP,
-        speed
+        PARTICLECOUNT,
+        camera.speed
     );
-    speedCursorPos = textBase + 32*14 + 13;
-    statsCursorPos = textBase + 32*16 + 13;
-    vsyncCursorPos = textBase + 32*17 + 13;
-
-	int bgId = bgInit(3, BgType_Bmp16, BgSize_B16_256x256, 0, 0);
-    bool phase = false;
-    u16* buffer1 = bgGetGfxPtr(bgId);
-    u16* buffer2 = bgGetGfxPtr(bgId) + 256*256;
-
-    s32 animationTime = 0;
-//    animationTime = 21989; speed = 0; // Slow frame test
-    u32 startTime = 0;
+    particlesCursorPos = textBase + 32*15 + 13;
+    speedCursorPos = textBase + 32*16 + 13;
+    statsCursorPos = textBase + 32*17 + 13;
+    vsyncCursorPos = textBase + 32*18 + 13;
+    presentCursorPos = textBase + 32*19 + 13;
+    inputCursorPos = textBase + 32*20 + 13;
+    DC_InvalidateRange(helpPage, sizeof(helpPage));
+    dmaCopy(textBase, helpPage, sizeof(helpPage));
+
+    s32 lastBuffer = 0;
+
     cpuStartTiming(0);
+    u32 startTime = cpuGetTiming();
+    u32 frameVblank = vblankCount;
+    InitGovernor(&governor, GOVERNORBUDGET);
+    InitProfiler(&profiler);
+    phaseStart = cpuGetTiming();
+    View shownView = { 0, 0, 0, 0, 0, 0 };
+    View lastView = { 0, 0, 0, 0, 0, 0 };
+    bool shownValid = false;
 	while(true)
 	{
-        phase = !phase;
-        bgSetMapBase(bgId, phase | trails ? 0 : 8);
-        u16* buffer = phase & !trails ? buffer2 : buffer1;
-
-        if (!trails)
+        // Start at most one frame per vblank, and advance the animation by the
+        // vblanks since the last start so it keeps time when frames run long.
+        // A replay advances by the logged vblanks instead
+        if (vblankCount == frameVblank)
         {
-            dmaFillWords(0, buffer, SCREENWIDTH*SCREENHEIGHT*2);
+            swiWaitForVBlank();
         }
+        const u32 vblank = vblankCount;
+        InputRun input = { 0, 0, 0, vblank - frameVblank > 255 ? 255 : vblank - frameVblank, 1 };
+        if (replaying && !NextInput(&replay, &input))
+        {
+            replaying = false;
+        }
+        AdvanceCamera(&camera, input.vblanks);
+        frameVblank = vblank;
+        u32 usecvsync = timerTicks2usec(cpuGetTiming()-startTime);
+        startTime = cpuGetTiming();
+        if (replaying)
+        {
+            ++replayFrames;
+            replayUsec += usecvsync;
+        }
+        EndPhase(PHASEVBLANK);
 
-        s32 ang1Start = animationTime;
-        s32 ang2Start = animationTime;
-
-        u16* screenCentre = buffer + ((SCREENWIDTH + SCREENWIDTH*SCREENHEIGHT)>>1);
+        View view = { camera.animationTime, camera.scaleMul, camera.xPan, camera.yPan, 0, 0 };
+        GovernorQuality(governor.level, &view);
 
-        u16* colourPtr = ColourTable;
-        for (u32 i = 0; i < CURVECOUNT; i += CURVESTEP)
+        // A fixed universe replaces the governed 16bpp kernel
+        const bool fixedUniverse = universe >= 0 && !paletted;
+        if (fixedUniverse)
         {
-            s32 x = 0, y = 0;
-            for (u32 j = 0; j < ITERATIONS/UNROLLCOUNT; ++j)
-            {
-                s32 values1, values2, pX, pY;
-
-                UNROLL; UNROLL; UNROLL; UNROLL;
+            view.curves = Universes[universe].curves;
+            view.iterations = Universes[universe].iterations;
+        }
+        bool cached = !fixedUniverse && !fading && PointCacheMatches(&pointCache, &view);
+        bool rendered = false;
+        bool panning = view.xPan != lastView.xPan || view.yPan != lastView.yPan;
+        s32 xScroll = shownView.xPan - view.xPan;
+        s32 yScroll = shownView.yPan - view.yPan;
+        lastView = view;
+
+        if (shownValid && !fading && !memcmp(&view, &shownView, sizeof(View)))
+        {
+            Present(lastBuffer, 0, 0);
+        }
+        else if (shownValid && cached && !trails && panning && view.scaleMul == shownView.scaleMul &&
+                 xScroll >= -PANSCROLLLIMIT && xScroll <= PANSCROLLLIMIT && yScroll >= -PANSCROLLLIMIT && yScroll <= PANSCROLLLIMIT)
+        {
+            Present(lastBuffer, xScroll, yScroll);
+        }
+        else
+        {
+            // Trails draw over the one buffer, which stays on screen
+            lastBuffer = trails ? 0 : FreeBuffer();
+            void* buffer = buffers[lastBuffer];
+            rendering = true;
 
-                colourPtr++;
+            EraseList* eraseList = 0;
+            if (!trails)
+            {
+                eraseList = &eraseLists[lastBuffer];
+                if (paletted)
+                {
+                    EraseFrame8(buffer, eraseList);
+                }
+                else
+                {
+                    EraseFrame(buffer, eraseList);
+                }
             }
+            EndPhase(PHASECLEAR);
 
-            ang1Start += ANG1INC;
-            ang2Start += ANG2INC;
+            PointCache* cache = camera.speed ? 0 : &pointCache;
+            if (fading)
+            {
+                RenderFadeFrame(buffer, &view, &fadeState);
+                rendered = true;
+            }
+            else if (fixedUniverse)
+            {
+                RenderUniverseFrame(universe, buffer, &view, eraseList);
+            }
+            else if (paletted)
+            {
+                if (cached)
+                {
+                    PlotCachedFrame8(buffer, &view, eraseList, &pointCache);
+                }
+                else
+                {
+                    RenderLiveFrame(buffer, &view, eraseList, cache);
+                    rendered = true;
+                }
+            }
+            else
+            {
+                if (cached)
+                {
+                    PlotCachedFrame(buffer, &view, eraseList, &pointCache);
+                }
+                else
+                {
+                    RenderLiveFrame(buffer, &view, eraseList, cache);
+                    rendered = true;
+                }
+            }
+            Present(lastBuffer, 0, 0);
+            rendering = false;
+            shownView = view;
+            shownValid = true;
         }
+        EndPhase(PHASEKERNEL);
 
         u32 usec = timerTicks2usec(cpuGetTiming()-startTime);
-		swiWaitForVBlank();
-        u32 usecvsync = timerTicks2usec(cpuGetTiming()-startTime);
-        startTime = cpuGetTiming();
 
-        textCursor = speedCursorPos;
-        printNumber(speed); PRINTCHAR(' ');
-        textCursor = statsCursorPos;
-        printNumber(usec/1000); PRINTCHAR('m'); PRINTCHAR('s'); PRINTCHAR(' ');
-        printNumber((1000000+(usec>>1))/usec); PRINTCHAR('f'); PRINTCHAR('p'); PRINTCHAR('s');
-        textCursor = vsyncCursorPos;
-        printNumber(usecvsync/1000); PRINTCHAR('m'); PRINTCHAR('s'); PRINTCHAR(' ');
-        printNumber((1000000+(usecvsync>>1))/usecvsync); PRINTCHAR('f'); PRINTCHAR('p'); PRINTCHAR('s');
+        // Fading changes the palette every frame, so that frame stays locked to vblank
+        if (fading)
+        {
+            swiWaitForVBlank();
+            FadePalette(&fadeState, BG_PALETTE);
+            EndPhase(PHASEVBLANK);
+        }
+
+        if (rendered)
+        {
+            UpdateGovernor(&governor, usec);
+        }
+
+        if (profilePage)
+        {
+            if (++profileRefresh == PROFILEREFRESH)
+            {
+                DrawProfilePage();
+                profileRefresh = 0;
+            }
+        }
+        else
+        {
+            textCursor = particlesCursorPos;
+            printNumber(view.curves * view.iterations); PRINTCHAR(' ');
+            textCursor = speedCursorPos;
+            printNumber(camera.speed); PRINTCHAR(' ');
+            textCursor = statsCursorPos;
+            printNumber(usec/1000); PRINTCHAR('m'); PRINTCHAR('s'); PRINTCHAR(' ');
+            printNumber((1000000+(usec>>1))/usec); PRINTCHAR('f'); PRINTCHAR('p'); PRINTCHAR('s');
+            textCursor = vsyncCursorPos;
+            printNumber(usecvsync/1000); PRINTCHAR('m'); PRINTCHAR('s'); PRINTCHAR(' ');
+            printNumber((1000000+(usecvsync>>1))/usecvsync); PRINTCHAR('f'); PRINTCHAR('p'); PRINTCHAR('s');
+            textCursor = presentCursorPos;
+            printNumber(droppedFrames); PRINTCHAR('/'); printNumber(duplicatedFrames);
+            DrawInputStatus();
+        }
+        EndPhase(PHASEHUD);
 
 		scanKeys();
-		int pressed = keysHeld();
-        int modSpeed = (pressed & KEY_L ? 4 : 1) + (pressed & KEY_R ? 8 : 0);
-		if(pressed & KEY_LEFT) xPan += modSpeed;
-		if(pressed & KEY_RIGHT) xPan -= modSpeed;
-		if(pressed & KEY_UP) yPan += modSpeed;
-		if(pressed & KEY_DOWN) yPan -= modSpeed;
-		if((pressed & KEY_A) && !justReset) scaleMul += modSpeed;
-		if((pressed & KEY_B) && !justReset) scaleMul -= modSpeed;
-        if(!(pressed & (KEY_A|KEY_B))) justReset = false;
-		pressed = keysDownRepeat();
-        if((pressed & KEY_A) && (pressed & KEY_B)) { scaleMul = SCALEMUL; xPan = yPan = 0; justReset = true; }
-		if(pressed & KEY_X) speed += modSpeed;
-		if(pressed & KEY_Y) speed -= modSpeed;
-        pressed = keysDown();
-        if(pressed & KEY_START)
+        const u16 liveHeld = keysHeld();
+        const u16 liveDown = keysDown();
+
+        // The record, replay and universe combos are never logged, and touch
+        // only flips the HUD so it stays live during a replay. A combo frame
+        // is still logged without keys so the animation keeps time
+        const bool recordCombo = (liveDown & KEY_SELECT) && (liveHeld & KEY_R);
+        const bool replayCombo = (liveDown & KEY_START) && (liveHeld & KEY_R);
+        const bool universeCombo = (liveDown & KEY_START) && (liveHeld & KEY_L);
+        if(!replaying)
+        {
+            if (!recordCombo && !replayCombo && !universeCombo)
+            {
+                input.held = liveHeld & ~KEY_TOUCH;
+                input.down = liveDown & ~KEY_TOUCH;
+                input.downRepeat = keysDownRepeat() & ~KEY_TOUCH;
+            }
+            if (recording && !RecordInput(&inputLog, &input))
+            {
+                ToggleRecording();
+            }
+        }
+        if(recordCombo)
+        {
+            ToggleRecording();
+        }
+        else if(replayCombo)
+        {
+            NextReplay();
+            shownValid = false;
+        }
+        else if(universeCombo)
+        {
+            universe = universe + 1 < UNIVERSES ? universe + 1 : -1;
+            LoadUniverseColours(universe);
+            shownValid = false;
+        }
+        UpdateCamera(&camera, &input);
+
+        int pressed = input.down;
+        if((pressed & KEY_SELECT) && (input.held & KEY_L))
         {
-            if (speed)
+            paletted = !paletted;
+            fading = false;
+            shownValid = false;
+            InitDisplay();
+        }
+        else if(pressed & KEY_SELECT)
+        {
+            if (!trails)
+            {
+                trails = true;
+            }
+            else if (paletted && !fading)
             {
-                oldSpeed = speed;
-                speed = 0;
+                fading = true;
+                InitFade(buffers[0], &fadeState);
             }
             else
             {
-                speed = oldSpeed;
+                trails = false;
+                if (fading)
+                {
+                    fading = false;
+                    LoadPalette();
+                }
+            }
+            shownValid = false;
+            for (s32 i = 0; i < PRESENTBUFFERS; ++i)
+            {
+                InvalidateEraseList(&eraseLists[i]);
             }
         }
-        if(pressed & KEY_SELECT)
+        if(liveDown & KEY_TOUCH)
         {
-            trails = !trails;
-            phase = false;
+            ShowProfilePage(!profilePage);
         }
 
-        animationTime += speed;
+        EndPhase(PHASEINPUT);
+        ProfilerEndFrame(&profiler);
 	}
 }
@@ -0,0 +1,90 @@
+#include <string.h>
+#include "offload.h"
+#include "sinlayout.h"
+
+#if SINLAYOUT == SINLAYOUTPACKED
+#define OFFLOADSINCOS(table, angle, s, c) SINCOSPACKED((const s32*)(table), angle, s, c)
+#elif SINLAYOUT == SINLAYOUTWAVE16
+#define OFFLOADSINCOS(table, angle, s, c) SINCOSWAVE16((const s16*)(table), angle, s, c)
+#else
+#define OFFLOADSINCOS(table, angle, s, c) SINCOSQUARTER((const s16*)(table), angle, s, c)
+#endif
+
+void InitOffload(Offload* offload)
+{
+    memset(offload, 0, sizeof(Offload));
+}
+
+void OffloadBeginFrame(Offload* offload, const View* view, u32 firstCurve, const void* sinTable)
+{
+    offload->view = *view;
+    offload->firstCurve = firstCurve;
+    offload->sinTable = sinTable;
+    StoreRelease(&offload->frame, offload->frame + 1);
+#ifdef ARM9
+    fifoSendValue32(OFFLOADFIFO, offload->frame);
+#endif
+}
+
+void OffloadEndFrame(Offload* offload)
+{
+    while (LoadAcquire(&offload->done) != offload->frame)
+    {
+        SpinPause();
+    }
+}
+
+bool OffloadWork(Offload* offload, u32* lastFrame)
+{
+    const u32 frame = LoadAcquire(&offload->frame);
+    if (frame == *lastFrame)
+    {
+        return false;
+    }
+
+    const View* view = &offload->view;
+    const void* sinTable = offload->sinTable;
+    OffloadRing* ring = &offload->ring;
+    u32 head = ring->head;
+    u32 tail = LoadAcquire(&ring->tail);
+
+    s32 ang1Start = view->animationTime + offload->firstCurve*ANG1INC;
+    s32 ang2Start = view->animationTime + offload->firstCurve*ANG2INC;
+    for (u32 i = offload->firstCurve; i < view->curves; ++i)
+    {
+        s32 x = 0, y = 0;
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            if (head - tail == OFFLOADRINGSIZE)
+            {
+                StoreRelease(&ring->head, head);
+                while ((tail = LoadAcquire(&ring->tail)) + OFFLOADRINGSIZE == head)
+                {
+                    SpinPause();
+                }
+            }
+
+            s32 sin1, cos1, sin2, cos2;
+            const s32 angle1 = (ang1Start + x)&(SINTABLEENTRIES-1);
+            const s32 angle2 = (ang2Start + y)&(SINTABLEENTRIES-1);
+            OFFLOADSINCOS(sinTable, angle1, sin1, cos1);
+            OFFLOADSINCOS(sinTable, angle2, sin2, cos2);
+            x = sin1 + sin2;
+            y = cos1 + cos2;
+            ring->points[head++ & (OFFLOADRINGSIZE-1)] = (u16)x | ((u32)y<<16);
+
+            if (!(head & (OFFLOADBATCH-1)))
+            {
+                StoreRelease(&ring->head, head);
+            }
+        }
+        StoreRelease(&ring->head, head);
+
+        ang1Start += ANG1INC;
+        ang2Start += ANG2INC;
+    }
+
+    *lastFrame = frame;
+    StoreRelease(&offload->done, frame);
+    return true;
+}
@@ -0,0 +1,52 @@
+#ifndef OFFLOAD_H
+#define OFFLOAD_H
+
+#include "render.h"
+
+// The ARM7 computes the last curves of each frame and hands their points to the
+// ARM9 through a single-producer/single-consumer ring, the ARM9 plots them after
+// its own curves so later curves still win
+
+#define OFFLOADRINGSIZE 8192
+#define OFFLOADBATCH 64
+
+// Each posted frame is also signalled through this FIFO channel, so the ARM7 can
+// sleep between frames instead of polling main RAM
+#if defined(ARM9) || defined(ARM7)
+#define OFFLOADFIFO FIFO_USER_02
+#endif
+
+// head is only written by the producer and tail by the consumer, each on its own
+// cache line; both count points and wrap freely
+typedef struct
+{
+    u32 head __attribute__((aligned(64)));
+    u32 tail __attribute__((aligned(64)));
+    s32 points[OFFLOADRINGSIZE] __attribute__((aligned(64)));
+} OffloadRing;
+
+// The frame barrier: the ARM9 writes view, firstCurve and sinTable then bumps
+// frame, the ARM7 sets done to that frame once its last point is in the ring.
+// On the DS this lives in uncached main RAM, sized to whole cache lines
+typedef struct
+{
+    u32 frame;
+    u32 done;
+    View view;
+    u32 firstCurve;
+    const void* sinTable;
+    OffloadRing ring;
+} __attribute__((aligned(64))) Offload;
+
+void InitOffload(Offload* offload);
+
+// ARM9
+void OffloadBeginFrame(Offload* offload, const View* view, u32 firstCurve, const void* sinTable);
+void OffloadEndFrame(Offload* offload);
+void RenderOffloadFrame(u16* buffer, const View* view, EraseList* eraseList, Offload* offload, u32 offloadCurves);
+void RenderOffloadFrame8(u8* buffer, const View* view, EraseList* eraseList, Offload* offload, u32 offloadCurves);
+
+// ARM7, returns false when no new frame has been posted
+bool OffloadWork(Offload* offload, u32* lastFrame);
+
+#endif
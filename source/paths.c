@@ -0,0 +1,47 @@
+#include "input.h"
+
+// Benchmark scenarios for replay, on hardware with R+Start and on the host
+// with host/replay. Each frame advances one vblank, so they play identically
+// on both; HOLD runs are capped at 255 frames
+
+#define HOLD(keys, frames) { (keys), 0, 0, 1, (frames) }
+
+// From the default view to scaleMul 8101, the ARM kernel's top scale, with
+// L+R held for the fastest zoom
+static const InputRun deepZoom[] =
+{
+    HOLD(0, 60),
+    HOLD(KEY_A|KEY_L|KEY_R, 255),
+    HOLD(KEY_A|KEY_L|KEY_R, 255),
+    HOLD(KEY_A|KEY_L|KEY_R, 140),
+    HOLD(0, 120),
+};
+
+// A square at R speed, 9 pixels a frame, leaving the universe off each edge
+static const InputRun fastPan[] =
+{
+    HOLD(KEY_R|KEY_RIGHT, 30),
+    HOLD(KEY_R|KEY_DOWN, 30),
+    HOLD(KEY_R|KEY_LEFT, 60),
+    HOLD(KEY_R|KEY_UP, 60),
+    HOLD(KEY_R|KEY_RIGHT, 60),
+    HOLD(KEY_R|KEY_DOWN, 30),
+    HOLD(KEY_R|KEY_LEFT, 30),
+    HOLD(KEY_R|KEY_LEFT|KEY_UP, 120),
+    HOLD(KEY_R|KEY_RIGHT|KEY_DOWN, 120),
+};
+
+// Creeps through the slow frame at animationTime 21989
+static const InputRun slowFrame[] =
+{
+    HOLD(0, 240),
+};
+
+#define PATH(name, time, speed, runs) { name, { time, speed, 0, SCALEMUL, 0, 0, false }, sizeof(runs)/sizeof(InputRun), runs }
+
+const CameraPath CameraPaths[CAMERAPATHS] =
+{
+    PATH("deepzoom", 0, 8, deepZoom),
+    PATH("fastpan", 0, 8, fastPan),
+    PATH("slowframe", 21989-120, 1, slowFrame),
+};
@@ -0,0 +1,108 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#if defined(ARM9) || defined(ARM7)
+
+#include <nds.h>
+
+// Words shared between the CPUs are only accessed through uncached main RAM and
+// both cores retire memory operations in order, so only the compiler can reorder
+static inline u32 LoadAcquire(const volatile u32* word)
+{
+    const u32 value = *word;
+    asm volatile("" ::: "memory");
+    return value;
+}
+
+static inline void StoreRelease(volatile u32* word, u32 value)
+{
+    asm volatile("" ::: "memory");
+    *word = value;
+}
+
+static inline void SpinPause()
+{
+}
+
+static inline void FillWords(u32 value, void* dest, u32 size)
+{
+    dmaFillWords(value, dest, size);
+}
+
+// VRAM ignores byte writes from the ARM9, so merge the byte into its halfword
+static inline void PlotByte(u8* dest, u8 value)
+{
+    u16* pair = (u16*)((u32)dest & ~1);
+    *pair = ((u32)dest & 1) ? (*pair & 0x00ff) | (value << 8) : (*pair & 0xff00) | value;
+}
+
+#else
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sched.h>
+
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+
+#define BIT(n) (1<<(n))
+
+// The libnds key bits, so input logs replay on the host
+#define KEY_A BIT(0)
+#define KEY_B BIT(1)
+#define KEY_SELECT BIT(2)
+#define KEY_START BIT(3)
+#define KEY_RIGHT BIT(4)
+#define KEY_LEFT BIT(5)
+#define KEY_UP BIT(6)
+#define KEY_DOWN BIT(7)
+#define KEY_R BIT(8)
+#define KEY_L BIT(9)
+#define KEY_X BIT(10)
+#define KEY_Y BIT(11)
+#define KEY_TOUCH BIT(12)
+#define KEY_LID BIT(13)
+
+#define DTCM_DATA
+#define DTCM_BSS
+#define ITCM_CODE
+
+static inline u32 LoadAcquire(const volatile u32* word)
+{
+    return __atomic_load_n(word, __ATOMIC_ACQUIRE);
+}
+
+static inline void StoreRelease(volatile u32* word, u32 value)
+{
+    __atomic_store_n(word, value, __ATOMIC_RELEASE);
+}
+
+// Lets the other side of a spin wait run when the host has fewer cores than threads
+static inline void SpinPause()
+{
+    sched_yield();
+}
+
+static inline void FillWords(u32 value, void* dest, u32 size)
+{
+    u32* words = (u32*)dest;
+    for (u32 i = 0; i < size/4; ++i)
+    {
+        words[i] = value;
+    }
+}
+
+static inline void PlotByte(u8* dest, u8 value)
+{
+    *dest = value;
+}
+
+#endif
+
+#endif
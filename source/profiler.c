@@ -0,0 +1,89 @@
+#include "profiler.h"
+
+const char* const PhaseNames[PHASECOUNT] = { "Clear", "Kernel", "HUD", "Input", "Vblank" };
+
+void InitProfiler(Profiler* profiler)
+{
+    for (u32 i = 0; i < PHASECOUNT; ++i)
+    {
+        profiler->samples[0][i] = 0;
+    }
+    profiler->frame = 0;
+    profiler->count = 0;
+}
+
+void ProfilerRecord(Profiler* profiler, u32 phase, u32 time)
+{
+    profiler->samples[profiler->frame][phase] += time;
+}
+
+void ProfilerEndFrame(Profiler* profiler)
+{
+    profiler->frame = (profiler->frame + 1) % (PROFILEFRAMES+1);
+    if (profiler->count < PROFILEFRAMES)
+    {
+        profiler->count++;
+    }
+    for (u32 i = 0; i < PHASECOUNT; ++i)
+    {
+        profiler->samples[profiler->frame][i] = 0;
+    }
+}
+
+// Sorts a copy of the last PROFILEFRAMES completed frames, which at PROFILEFRAMES entries is
+// cheap enough to run every few frames on the ARM9
+static void Stats(u32* values, u32 count, PhaseStats* stats)
+{
+    if (!count)
+    {
+        stats->min = stats->avg = stats->p95 = stats->max = 0;
+        return;
+    }
+
+    u32 total = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+        const u32 value = values[i];
+        u32 j = i;
+        for (; j > 0 && values[j-1] > value; --j)
+        {
+            values[j] = values[j-1];
+        }
+        values[j] = value;
+        total += value;
+    }
+    stats->min = values[0];
+    stats->avg = total / count;
+    stats->p95 = values[(count*95 - 1) / 100];
+    stats->max = values[count-1];
+}
+
+static u32 Completed(const Profiler* profiler, u32 age)
+{
+    return (profiler->frame + PROFILEFRAMES - age) % (PROFILEFRAMES+1);
+}
+
+void ProfilerStats(const Profiler* profiler, u32 phase, PhaseStats* stats)
+{
+    u32 values[PROFILEFRAMES];
+    for (u32 i = 0; i < profiler->count; ++i)
+    {
+        values[i] = profiler->samples[Completed(profiler, i)][phase];
+    }
+    Stats(values, profiler->count, stats);
+}
+
+void ProfilerFrameStats(const Profiler* profiler, PhaseStats* stats)
+{
+    u32 values[PROFILEFRAMES];
+    for (u32 i = 0; i < profiler->count; ++i)
+    {
+        const u32* samples = profiler->samples[Completed(profiler, i)];
+        values[i] = 0;
+        for (u32 phase = 0; phase < PHASECOUNT; ++phase)
+        {
+            values[i] += samples[phase];
+        }
+    }
+    Stats(values, profiler->count, stats);
+}
@@ -0,0 +1,38 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "platform.h"
+
+#define PHASECLEAR 0
+#define PHASEKERNEL 1
+#define PHASEHUD 2
+#define PHASEINPUT 3
+#define PHASEVBLANK 4
+#define PHASECOUNT 5
+
+#define PROFILEFRAMES 64
+
+typedef struct
+{
+    u32 samples[PROFILEFRAMES+1][PHASECOUNT];
+    u32 frame;
+    u32 count;
+} Profiler;
+
+typedef struct
+{
+    u32 min;
+    u32 avg;
+    u32 p95;
+    u32 max;
+} PhaseStats;
+
+extern const char* const PhaseNames[PHASECOUNT];
+
+void InitProfiler(Profiler* profiler);
+void ProfilerRecord(Profiler* profiler, u32 phase, u32 time);
+void ProfilerEndFrame(Profiler* profiler);
+void ProfilerStats(const Profiler* profiler, u32 phase, PhaseStats* stats);
+void ProfilerFrameStats(const Profiler* profiler, PhaseStats* stats);
+
+#endif
@@ -0,0 +1,851 @@
+#include "render.h"
+#include "offload.h"
+#include "sinlayout.h"
+#include "sintable.h"
+
+#if SINLAYOUT == SINLAYOUTPACKED
+s32 SinTable[SINTABLEENTRIES];
+#define SINCOS SINCOSPACKED
+#elif SINLAYOUT == SINLAYOUTWAVE16
+// A small enough table shares DTCM with ColourTable and the stack
+#if SINTABLEINDTCM
+DTCM_BSS
+#endif
+s16 SinTable[SINTABLEENTRIES];
+#define SINCOS SINCOSWAVE16
+#else
+#define SinTable compactsintable
+#define SINCOS SINCOSQUARTER
+#endif
+#if SINTABLEINDTCM
+#define DTCMSINBYTES sizeof(SinTable)
+#else
+#define DTCMSINBYTES 0
+#endif
+DTCM_BSS u16 ColourTable[PARTICLECOUNT/UNROLLCOUNT];
+// Only the 8bpp path reads the indices, so they stay in main RAM and leave DTCM
+// to the 16bpp colours and a WAVE16 sin table
+u8 ColourIndexTable[PARTICLECOUNT/UNROLLCOUNT];
+u8 FadeIndexTable[PARTICLECOUNT/UNROLLCOUNT];
+u16 Palette[PALETTESIZE];
+bool CullingEnabled = true;
+
+// Every point is a sum of two table entries, so lies within this of the origin
+// on each axis; set by ExpandSinTable
+static s32 PointRange;
+
+// The view's window in point coordinates: a point is on screen exactly when
+// x - xLow <= xSpan and y - yLow <= ySpan, unsigned
+typedef struct
+{
+    s32 xLow;
+    s32 yLow;
+    u32 xSpan;
+    u32 ySpan;
+    bool empty;
+    bool clip;
+} Cull;
+
+// The universe family: name, CURVECOUNT, CURVESTEP and ITERATIONS of each
+// compiled-in kernel, smallest first in UNIVERSE order
+#define UNIVERSELIST(U) \
+    U(Small, 128, 4, 64) \
+    U(Medium, 256, 4, 256) \
+    U(Large, 512, 4, 256) \
+    U(Huge, 1024, 4, 256)
+
+// Only the active universe needs colours. They are loaded into the DTCM
+// ColourTable when they fit, otherwise into this main RAM table, sized for the
+// biggest universe
+#define UNIVERSECOLOURS(name, curveCount, curveStep, iterations) \
+    u16 name[((curveCount)/(curveStep))*(iterations)/UNROLLCOUNT];
+static union { UNIVERSELIST(UNIVERSECOLOURS) } UniverseColourTable;
+static const u16* universeColours = ColourTable;
+static s32 colouredUniverse = -1;
+
+#define UNIVERSEINFO(name, curveCount, curveStep, iterations) \
+    { #name, curveCount, curveStep, iterations, (curveCount)/(curveStep), ((curveCount)/(curveStep))*(iterations) },
+const Universe Universes[UNIVERSES] = { UNIVERSELIST(UNIVERSEINFO) };
+
+#ifdef ARM9
+_Static_assert(sizeof(ColourTable) + DTCMSINBYTES <= DTCMBYTES - DTCMSTACKBYTES,
+               "the DTCM tables leave too little room for the stack");
+#endif
+
+void ExpandPackedSinTable(s32* table)
+{
+    for (int i = 0; i < SINTABLEENTRIES/4; ++i)
+    {
+        table[i] = table[SINTABLEENTRIES/2 - i - 1] = compactsintable[i];
+        table[SINTABLEENTRIES/2 + i] = table[SINTABLEENTRIES - i - 1] = -compactsintable[i];
+    }
+    for (int i = 0; i < SINTABLEENTRIES; ++i)
+    {
+        *((s16*)(table+i)+1) = *(s16*)(table+((i+SINTABLEENTRIES/4)%SINTABLEENTRIES));
+    }
+}
+
+void ExpandWaveSinTable(s16* table)
+{
+    for (int i = 0; i < SINTABLEENTRIES/4; ++i)
+    {
+        table[i] = table[SINTABLEENTRIES/2 - i - 1] = compactsintable[i];
+        table[SINTABLEENTRIES/2 + i] = table[SINTABLEENTRIES - i - 1] = -compactsintable[i];
+    }
+}
+
+void ExpandSinTable()
+{
+#if SINLAYOUT == SINLAYOUTPACKED
+    ExpandPackedSinTable(SinTable);
+#elif SINLAYOUT == SINLAYOUTWAVE16
+    ExpandWaveSinTable(SinTable);
+#endif
+    PointRange = 0;
+    for (int i = 0; i < SINTABLEENTRIES/4; ++i)
+    {
+        const s32 value = compactsintable[i] < 0 ? -compactsintable[i] : compactsintable[i];
+        PointRange = 2*value > PointRange ? 2*value : PointRange;
+    }
+}
+
+static u16 GradientColour(s32 red, s32 green)
+{
+    red |= BIT(15);
+    const s32 blue = (62-(red+green))>>1;
+    return red + (green<<5) + (blue<<10);
+}
+
+// The palette holds a 16x16 grid of the red/green gradient, index 0 is the
+// transparent backdrop so the darkest entry borrows its neighbour
+static u8 GradientIndex(s32 red, s32 green)
+{
+    const u8 index = ((red>>1)<<4) | (green>>1);
+    return index ? index : 1;
+}
+
+// Fading splits the palette into FADESLOTS blocks of an 8x4 gradient grid, one
+// block per frame of age; colour 0 borrows its neighbour to keep index 0 clear
+static u8 FadeColour(s32 red, s32 green)
+{
+    const u8 colour = ((red>>2)<<2) | (green>>3);
+    return colour ? colour : 1;
+}
+
+void InitColourTable()
+{
+    int colourIndex = 0;
+    for (int i = 0; i < CURVECOUNT; i += CURVESTEP)
+    {
+        const s32 red = (i*32)/CURVECOUNT;
+        for (int j = 0; j < ITERATIONS; j += UNROLLCOUNT)
+        {
+            const s32 green = (j*32)/ITERATIONS;
+            ColourTable[colourIndex] = GradientColour(red, green);
+            ColourIndexTable[colourIndex] = GradientIndex(red, green);
+            FadeIndexTable[colourIndex++] = FadeColour(red, green);
+        }
+    }
+    colouredUniverse = -1;
+}
+
+static void FillGradient(u16* colours, u32 curveCount, u32 curveStep, u32 iterations)
+{
+    for (u32 i = 0; i < curveCount; i += curveStep)
+    {
+        for (u32 j = 0; j < iterations; j += UNROLLCOUNT)
+        {
+            *colours++ = GradientColour((i*32)/curveCount, (j*32)/iterations);
+        }
+    }
+}
+
+// Switching universe regenerates the colours once rather than keeping a table
+// per universe; -1 restores the build's own gradient for the general kernels
+void LoadUniverseColours(s32 universe)
+{
+    if (universe == colouredUniverse)
+    {
+        return;
+    }
+    if (universe < 0)
+    {
+        FillGradient(ColourTable, CURVECOUNT, CURVESTEP, ITERATIONS);
+        universeColours = ColourTable;
+    }
+    else
+    {
+        const Universe* info = &Universes[universe];
+        u16* colours = info->particles <= PARTICLECOUNT ? ColourTable : (u16*)&UniverseColourTable;
+        FillGradient(colours, info->curveCount, info->curveStep, info->iterations);
+        universeColours = colours;
+    }
+    colouredUniverse = universe;
+}
+
+void InitPalette()
+{
+    Palette[0] = 0;
+    for (int i = 1; i < PALETTESIZE; ++i)
+    {
+        Palette[i] = GradientColour(((i>>4)<<1)|1, ((i&15)<<1)|1);
+    }
+}
+
+#define STEP \
+    angle1 = (ang1Start + x)&(SINTABLEENTRIES-1); \
+    angle2 = (ang2Start + y)&(SINTABLEENTRIES-1); \
+    SINCOS(SinTable, angle1, sin1, cos1); \
+    SINCOS(SinTable, angle2, sin2, cos2); \
+    x = sin1 + sin2; \
+    y = cos1 + cos2; \
+    if (cachePoints) \
+    { \
+        *pointCursor++ = (u16)x | ((u32)y<<16); \
+    } \
+
+#define PLOTPIXEL \
+    if (paletted) \
+    { \
+        PlotByte((u8*)screenCentre + offset, *indexPtr + indexBias); \
+    } \
+    else \
+    { \
+        ((u16*)screenCentre)[offset] = *colourPtr; \
+    } \
+    if (record) \
+    { \
+        *eraseCursor++ = offset + centreOffset; \
+    } \
+
+#define PLOT \
+    pX = ((x * scaleMul) >> SINTABLEPOWER) + xPan; \
+    pY = ((y * scaleMul) >> SINTABLEPOWER) + yPan; \
+    if (pX >= -(SCREENWIDTH>>1) && pY >= -(SCREENHEIGHT>>1) && pX < (SCREENWIDTH>>1) && pY < (SCREENHEIGHT>>1)) \
+    { \
+        offset = pY*SCREENWIDTH + pX; \
+        PLOTPIXEL \
+    } \
+
+// Tests the point itself against the view's window so offscreen points skip
+// the multiplies, and skips the test when the window holds every point
+#define CULLEDPLOT \
+    if (!clip || ((u32)(x - cull->xLow) <= cull->xSpan && (u32)(y - cull->yLow) <= cull->ySpan)) \
+    { \
+        pX = ((x * scaleMul) >> SINTABLEPOWER) + xPan; \
+        pY = ((y * scaleMul) >> SINTABLEPOWER) + yPan; \
+        offset = pY*SCREENWIDTH + pX; \
+        PLOTPIXEL \
+    } \
+
+#define UNROLL STEP PLOT
+#define CULLEDUNROLL STEP CULLEDPLOT
+
+#define OFFLOADED \
+    point = ring->points[tail++ & (OFFLOADRINGSIZE-1)]; \
+    x = (s16)point; \
+    y = point>>16; \
+    PLOT
+
+#define CACHED \
+    point = *pointPtr++; \
+    x = (s16)point; \
+    y = point>>16; \
+    PLOT
+
+// The smallest x in [-PointRange, PointRange] that projects to at least target,
+// or PointRange+1; projection with a positive scale never decreases
+static s32 FirstProjectedAtLeast(s32 scale, s32 bias, s32 target)
+{
+    s32 low = -PointRange, high = PointRange + 1;
+    while (low < high)
+    {
+        const s32 mid = low + ((high - low)>>1);
+        if (((mid * scale) >> SINTABLEPOWER) + bias >= target)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+// The coordinates that project into [0, size), found for a negative scale by
+// mirroring x, which leaves x*scale unchanged; false when there are none
+static bool VisibleRange(s32 scale, s32 bias, s32 size, s32* low, s32* high)
+{
+    if (scale >= 0)
+    {
+        *low = FirstProjectedAtLeast(scale, bias, 0);
+        *high = FirstProjectedAtLeast(scale, bias, size) - 1;
+    }
+    else
+    {
+        const s32 mirroredLow = FirstProjectedAtLeast(-scale, bias, 0);
+        *low = -(FirstProjectedAtLeast(-scale, bias, size) - 1);
+        *high = -mirroredLow;
+    }
+    return *low <= *high;
+}
+
+// False when the scale is big enough for x*scaleMul to overflow, where the
+// projection is no longer monotonic and only the per-pixel test is exact
+static bool ViewCull(const View* view, Cull* cull)
+{
+    if (!PointRange || view->scaleMul >= 0x7fffffff/PointRange || view->scaleMul <= -(0x7fffffff/PointRange))
+    {
+        return false;
+    }
+    s32 xHigh, yHigh;
+    const bool xVisible = VisibleRange(view->scaleMul, view->xPan + (SCREENWIDTH>>1), SCREENWIDTH, &cull->xLow, &xHigh);
+    const bool yVisible = VisibleRange(view->scaleMul, view->yPan + (SCREENHEIGHT>>1), SCREENHEIGHT, &cull->yLow, &yHigh);
+    cull->empty = !xVisible || !yVisible;
+    cull->xSpan = xHigh - cull->xLow;
+    cull->ySpan = yHigh - cull->yLow;
+    cull->clip = cull->xLow > -PointRange || xHigh < PointRange || cull->yLow > -PointRange || yHigh < PointRange;
+    return true;
+}
+
+static inline __attribute__((always_inline)) u16* RenderCurves(void* buffer, const View* view, u16* eraseCursor, const bool record, s32* pointCursor, const bool cachePoints, const bool paletted, const u8* indexTable, const u8 indexBias, const Cull* cull, const bool clip)
+{
+    const s32 scaleMul = view->scaleMul;
+    const s32 xPan = view->xPan;
+    const s32 yPan = view->yPan;
+
+    s32 ang1Start = view->animationTime;
+    s32 ang2Start = view->animationTime;
+
+    const s32 centreOffset = (SCREENWIDTH + SCREENWIDTH*SCREENHEIGHT)>>1;
+    void* screenCentre = paletted ? (void*)((u8*)buffer + centreOffset) : (void*)((u16*)buffer + centreOffset);
+
+    const u32 groups = view->iterations/UNROLLCOUNT;
+    const u32 skippedGroups = ITERATIONS/UNROLLCOUNT - groups;
+
+    const u16* colourPtr = ColourTable;
+    const u8* indexPtr = indexTable;
+    for (u32 i = 0; i < view->curves; ++i)
+    {
+        s32 x = 0, y = 0;
+        for (u32 j = 0; j < groups; ++j)
+        {
+            s32 angle1, angle2, sin1, cos1, sin2, cos2, pX, pY, offset;
+
+            if (cull)
+            {
+                CULLEDUNROLL; CULLEDUNROLL; CULLEDUNROLL; CULLEDUNROLL;
+            }
+            else
+            {
+                UNROLL; UNROLL; UNROLL; UNROLL;
+            }
+
+            colourPtr++;
+            indexPtr++;
+        }
+
+        colourPtr += skippedGroups;
+        indexPtr += skippedGroups;
+        ang1Start += ANG1INC;
+        ang2Start += ANG2INC;
+    }
+    return eraseCursor;
+}
+
+static inline __attribute__((always_inline)) u16* PlotCachedPoints(void* buffer, const View* view, const PointCache* pointCache, u16* eraseCursor, const bool record, const bool paletted)
+{
+    const s32 scaleMul = view->scaleMul;
+    const s32 xPan = view->xPan;
+    const s32 yPan = view->yPan;
+    const u8 indexBias = 0;
+
+    const s32 centreOffset = (SCREENWIDTH + SCREENWIDTH*SCREENHEIGHT)>>1;
+    void* screenCentre = paletted ? (void*)((u8*)buffer + centreOffset) : (void*)((u16*)buffer + centreOffset);
+
+    const u32 groups = pointCache->iterations/UNROLLCOUNT;
+    const u32 skippedGroups = ITERATIONS/UNROLLCOUNT - groups;
+
+    const s32* pointPtr = pointCache->points;
+    const u16* colourPtr = ColourTable;
+    const u8* indexPtr = ColourIndexTable;
+    for (u32 i = 0; i < pointCache->curves; ++i)
+    {
+        for (u32 j = 0; j < groups; ++j)
+        {
+            s32 point, x, y, pX, pY, offset;
+
+            CACHED; CACHED; CACHED; CACHED;
+
+            colourPtr++;
+            indexPtr++;
+        }
+
+        colourPtr += skippedGroups;
+        indexPtr += skippedGroups;
+    }
+    return eraseCursor;
+}
+
+#if defined(ARMKERNEL) && SINLAYOUT == SINLAYOUTPACKED
+// Argument block for the hand-scheduled kernel in kernelarm.s, which reads it by
+// fixed offsets
+typedef struct
+{
+    u16* buffer;
+    const s32* sinTable;
+    const u16* colours;
+    u16* eraseCursor;
+    s32 scale;
+    s32 xBias;
+    s32 yBias;
+    s32 angStart;
+    s32 ang1Inc;
+    s32 ang2Inc;
+    u32 curves;
+    u32 groups;
+    u32 skippedGroups;
+} ArmKernelArgs;
+
+ITCM_CODE u16* RenderCurvesArm(const ArmKernelArgs* args);
+
+bool ArmKernelEnabled = true;
+
+// The assembly covers the 16bpp erase-list path without point caching, and needs
+// scaleMul<<2 to fit the 16 bit operand of SMULWB
+static bool UseArmKernel(const View* view, EraseList* eraseList, PointCache* pointCache, const bool paletted)
+{
+    return ArmKernelEnabled && eraseList && !pointCache && !paletted &&
+           view->curves && view->iterations >= UNROLLCOUNT &&
+           view->scaleMul >= -8192 && view->scaleMul < 8192;
+}
+
+static u16* RenderCurvesArmFrame(u16* buffer, const View* view, u16* eraseCursor)
+{
+    const ArmKernelArgs args =
+    {
+        buffer, SinTable, ColourTable, eraseCursor,
+        view->scaleMul<<2, view->xPan + (SCREENWIDTH>>1), view->yPan + (SCREENHEIGHT>>1),
+        view->animationTime, ANG1INC, ANG2INC,
+        view->curves, view->iterations/UNROLLCOUNT, ITERATIONS/UNROLLCOUNT - view->iterations/UNROLLCOUNT
+    };
+    return RenderCurvesArm(&args);
+}
+#endif
+
+static inline __attribute__((always_inline)) u16* RenderClipped(void* buffer, const View* view, u16* eraseStart, PointCache* pointCache, const bool paletted, const Cull* cull, const bool clip)
+{
+    if (eraseStart && pointCache)
+    {
+        return RenderCurves(buffer, view, eraseStart, true, pointCache->points, true, paletted, ColourIndexTable, 0, cull, clip);
+    }
+    else if (eraseStart)
+    {
+        return RenderCurves(buffer, view, eraseStart, true, 0, false, paletted, ColourIndexTable, 0, cull, clip);
+    }
+    else if (pointCache)
+    {
+        return RenderCurves(buffer, view, 0, false, pointCache->points, true, paletted, ColourIndexTable, 0, cull, clip);
+    }
+    return RenderCurves(buffer, view, 0, false, 0, false, paletted, ColourIndexTable, 0, cull, clip);
+}
+
+static inline __attribute__((always_inline)) void Render(void* buffer, const View* view, EraseList* eraseList, PointCache* pointCache, const bool paletted)
+{
+    u16* eraseStart = eraseList ? eraseList->offsets : 0;
+    u16* eraseEnd = eraseStart;
+    Cull cull;
+    const bool culling = CullingEnabled && ViewCull(view, &cull);
+    if (culling && cull.empty)
+    {
+        // Nothing can land on screen, and the window's spans are meaningless,
+        // so at most the points are wanted
+        if (pointCache)
+        {
+            ComputeCurvePoints(view, 0, view->curves, pointCache->points);
+        }
+    }
+#if defined(ARMKERNEL) && SINLAYOUT == SINLAYOUTPACKED
+    else if (UseArmKernel(view, eraseList, pointCache, paletted))
+    {
+        eraseEnd = RenderCurvesArmFrame(buffer, view, eraseStart);
+    }
+#endif
+    else if (culling && cull.clip)
+    {
+        eraseEnd = RenderClipped(buffer, view, eraseStart, pointCache, paletted, &cull, true);
+    }
+    else if (culling)
+    {
+        eraseEnd = RenderClipped(buffer, view, eraseStart, pointCache, paletted, &cull, false);
+    }
+    else
+    {
+        eraseEnd = RenderClipped(buffer, view, eraseStart, pointCache, paletted, 0, true);
+    }
+
+    if (eraseList)
+    {
+        eraseList->count = eraseEnd - eraseStart;
+        eraseList->valid = true;
+    }
+    if (pointCache)
+    {
+        pointCache->animationTime = view->animationTime;
+        pointCache->curves = view->curves;
+        pointCache->iterations = view->iterations;
+        pointCache->valid = true;
+    }
+}
+
+// Plots the ARM7's curves as they arrive, handing ring space back after each
+// curve and whenever it catches up with the producer
+static inline __attribute__((always_inline)) u16* PlotOffloadPoints(void* buffer, const View* view, Offload* offload, u32 firstCurve, u16* eraseCursor, const bool record, const bool paletted)
+{
+    const s32 scaleMul = view->scaleMul;
+    const s32 xPan = view->xPan;
+    const s32 yPan = view->yPan;
+    const u8 indexBias = 0;
+
+    const s32 centreOffset = (SCREENWIDTH + SCREENWIDTH*SCREENHEIGHT)>>1;
+    void* screenCentre = paletted ? (void*)((u8*)buffer + centreOffset) : (void*)((u16*)buffer + centreOffset);
+
+    const u32 groups = view->iterations/UNROLLCOUNT;
+    const u32 skippedGroups = ITERATIONS/UNROLLCOUNT - groups;
+
+    OffloadRing* ring = &offload->ring;
+    u32 tail = ring->tail;
+    u32 head = tail;
+    const u16* colourPtr = ColourTable + firstCurve*(ITERATIONS/UNROLLCOUNT);
+    const u8* indexPtr = ColourIndexTable + firstCurve*(ITERATIONS/UNROLLCOUNT);
+    for (u32 i = firstCurve; i < view->curves; ++i)
+    {
+        for (u32 j = 0; j < groups; ++j)
+        {
+            s32 point, x, y, pX, pY, offset;
+
+            if (head - tail < UNROLLCOUNT)
+            {
+                StoreRelease(&ring->tail, tail);
+                while ((head = LoadAcquire(&ring->head)) - tail < UNROLLCOUNT)
+                {
+                    SpinPause();
+                }
+            }
+
+            OFFLOADED; OFFLOADED; OFFLOADED; OFFLOADED;
+
+            colourPtr++;
+            indexPtr++;
+        }
+        StoreRelease(&ring->tail, tail);
+
+        colourPtr += skippedGroups;
+        indexPtr += skippedGroups;
+    }
+    return eraseCursor;
+}
+
+// The ARM9 renders the first curves while the ARM7 computes the last
+// offloadCurves, then plots the ARM7's points and waits at the frame barrier
+static inline __attribute__((always_inline)) void RenderOffload(void* buffer, const View* view, EraseList* eraseList, Offload* offload, u32 offloadCurves, const bool paletted)
+{
+    View own = *view;
+    own.curves = offloadCurves < view->curves ? view->curves - offloadCurves : 0;
+    OffloadBeginFrame(offload, view, own.curves, SinTable);
+    Render(buffer, &own, eraseList, 0, paletted);
+
+    if (eraseList)
+    {
+        u16* eraseStart = eraseList->offsets + eraseList->count;
+        u16* eraseEnd = PlotOffloadPoints(buffer, view, offload, own.curves, eraseStart, true, paletted);
+        eraseList->count += eraseEnd - eraseStart;
+    }
+    else
+    {
+        PlotOffloadPoints(buffer, view, offload, own.curves, 0, false, paletted);
+    }
+    OffloadEndFrame(offload);
+}
+
+static inline __attribute__((always_inline)) void PlotCached(void* buffer, const View* view, EraseList* eraseList, const PointCache* pointCache, const bool paletted)
+{
+    if (eraseList)
+    {
+        u16* eraseEnd = PlotCachedPoints(buffer, view, pointCache, eraseList->offsets, true, paletted);
+        eraseList->count = eraseEnd - eraseList->offsets;
+        eraseList->valid = true;
+    }
+    else
+    {
+        PlotCachedPoints(buffer, view, pointCache, 0, false, paletted);
+    }
+}
+
+// The 16bpp kernel with every size a constant, so each universe gets its own
+// loop bounds and angle increments folded in. The inner loop keeps the 4x
+// UNROLL: these instances run from main RAM through the 8KB instruction cache,
+// and fully unrolled ones would not stay resident in it
+static inline __attribute__((always_inline)) u16* RenderUniverseCurves(u16* buffer, const View* view, u16* eraseCursor, const bool record, const u16* colours, const u32 curveCount, const u32 curveStep, const u32 iterations)
+{
+    const bool cachePoints = false;
+    const bool paletted = false;
+    s32* pointCursor = 0;
+    const u8* indexPtr = 0;
+    const u8 indexBias = 0;
+    const s32 ang1Inc = (s32)((curveStep * SINTABLEENTRIES) / 235);
+    const s32 ang2Inc = (s32)((curveStep * SINTABLEENTRIES) / (2*PI));
+
+    const s32 scaleMul = view->scaleMul;
+    const s32 xPan = view->xPan;
+    const s32 yPan = view->yPan;
+
+    s32 ang1Start = view->animationTime;
+    s32 ang2Start = view->animationTime;
+
+    const s32 centreOffset = (SCREENWIDTH + SCREENWIDTH*SCREENHEIGHT)>>1;
+    u16* screenCentre = buffer + centreOffset;
+
+    const u16* colourPtr = colours;
+    for (u32 i = 0; i < curveCount/curveStep; ++i)
+    {
+        s32 x = 0, y = 0;
+        for (u32 j = 0; j < iterations/UNROLLCOUNT; ++j)
+        {
+            s32 angle1, angle2, sin1, cos1, sin2, cos2, pX, pY, offset;
+
+            UNROLL; UNROLL; UNROLL; UNROLL;
+
+            colourPtr++;
+        }
+
+        ang1Start += ang1Inc;
+        ang2Start += ang2Inc;
+    }
+    return eraseCursor;
+}
+
+#define UNIVERSEKERNEL(name, curveCount, curveStep, iterations) \
+static u16* Render##name##Universe(u16* buffer, const View* view, u16* eraseCursor) \
+{ \
+    return eraseCursor ? \
+        RenderUniverseCurves(buffer, view, eraseCursor, true, universeColours, curveCount, curveStep, iterations) : \
+        RenderUniverseCurves(buffer, view, 0, false, universeColours, curveCount, curveStep, iterations); \
+}
+UNIVERSELIST(UNIVERSEKERNEL)
+
+#define UNIVERSEENTRY(name, curveCount, curveStep, iterations) Render##name##Universe,
+static u16* (*const UniverseKernels[UNIVERSES])(u16*, const View*, u16*) = { UNIVERSELIST(UNIVERSEENTRY) };
+
+// Only the animation time, scale and pan of the view are used. Erase lists hold
+// PARTICLECOUNT offsets, so bigger universes leave theirs invalid and the next
+// erase clears the whole screen
+void RenderUniverseFrame(u32 universe, u16* buffer, const View* view, EraseList* eraseList)
+{
+    LoadUniverseColours(universe);
+    u16* eraseStart = eraseList && Universes[universe].particles <= PARTICLECOUNT ? eraseList->offsets : 0;
+    u16* eraseEnd = UniverseKernels[universe](buffer, view, eraseStart);
+    if (eraseStart)
+    {
+        eraseList->count = eraseEnd - eraseStart;
+        eraseList->valid = true;
+    }
+    else if (eraseList)
+    {
+        InvalidateEraseList(eraseList);
+    }
+}
+
+// Points of curves [firstCurve, firstCurve+curves) in the point cache layout, for
+// renderers that project them onto other targets
+void ComputeCurvePoints(const View* view, u32 firstCurve, u32 curves, s32* points)
+{
+    const bool cachePoints = true;
+    s32* pointCursor = points;
+    s32 ang1Start = view->animationTime + firstCurve*ANG1INC;
+    s32 ang2Start = view->animationTime + firstCurve*ANG2INC;
+    for (u32 i = 0; i < curves; ++i)
+    {
+        s32 x = 0, y = 0;
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            s32 angle1, angle2, sin1, cos1, sin2, cos2;
+
+            STEP;
+        }
+
+        ang1Start += ANG1INC;
+        ang2Start += ANG2INC;
+    }
+}
+
+// The on-screen plots of curves [firstCurve, firstCurve+curves) in draw order,
+// packed as the buffer offset with the colour in the high half, for renderers
+// that merge them elsewhere; returns how many were written
+u32 ProjectCurves(const View* view, u32 firstCurve, u32 curves, u32* plots)
+{
+    const bool cachePoints = false;
+    s32* pointCursor = 0;
+    const s32 scaleMul = view->scaleMul;
+    const s32 xBias = view->xPan + (SCREENWIDTH>>1);
+    const s32 yBias = view->yPan + (SCREENHEIGHT>>1);
+
+    u32* plotCursor = plots;
+    s32 ang1Start = view->animationTime + firstCurve*ANG1INC;
+    s32 ang2Start = view->animationTime + firstCurve*ANG2INC;
+    for (u32 i = firstCurve; i < firstCurve + curves; ++i)
+    {
+        const u16* colourPtr = ColourTable + i*(ITERATIONS/UNROLLCOUNT);
+        s32 x = 0, y = 0;
+        for (u32 j = 0; j < view->iterations; ++j)
+        {
+            s32 angle1, angle2, sin1, cos1, sin2, cos2;
+
+            STEP;
+
+            const s32 pX = ((x * scaleMul) >> SINTABLEPOWER) + xBias;
+            const s32 pY = ((y * scaleMul) >> SINTABLEPOWER) + yBias;
+            if ((u32)pX < SCREENWIDTH && (u32)pY < SCREENHEIGHT)
+            {
+                *plotCursor++ = (pY*SCREENWIDTH + pX) | ((u32)colourPtr[j/UNROLLCOUNT]<<16);
+            }
+        }
+
+        ang1Start += ANG1INC;
+        ang2Start += ANG2INC;
+    }
+    return plotCursor - plots;
+}
+
+bool PointCacheMatches(const PointCache* pointCache, const View* view)
+{
+    return pointCache->valid && pointCache->animationTime == view->animationTime &&
+           pointCache->curves == view->curves && pointCache->iterations == view->iterations;
+}
+
+void RenderFrame(u16* buffer, const View* view, EraseList* eraseList, PointCache* pointCache)
+{
+    Render(buffer, view, eraseList, pointCache, false);
+}
+
+void RenderFrame8(u8* buffer, const View* view, EraseList* eraseList, PointCache* pointCache)
+{
+    Render(buffer, view, eraseList, pointCache, true);
+}
+
+void RenderOffloadFrame(u16* buffer, const View* view, EraseList* eraseList, Offload* offload, u32 offloadCurves)
+{
+    RenderOffload(buffer, view, eraseList, offload, offloadCurves, false);
+}
+
+void RenderOffloadFrame8(u8* buffer, const View* view, EraseList* eraseList, Offload* offload, u32 offloadCurves)
+{
+    RenderOffload(buffer, view, eraseList, offload, offloadCurves, true);
+}
+
+void PlotCachedFrame(u16* buffer, const View* view, EraseList* eraseList, const PointCache* pointCache)
+{
+    PlotCached(buffer, view, eraseList, pointCache, false);
+}
+
+void PlotCachedFrame8(u8* buffer, const View* view, EraseList* eraseList, const PointCache* pointCache)
+{
+    PlotCached(buffer, view, eraseList, pointCache, true);
+}
+
+void EraseFrame(u16* buffer, EraseList* eraseList)
+{
+    if (!eraseList->valid || eraseList->count >= ERASEFILLTHRESHOLD)
+    {
+        FillWords(0, buffer, SCREENWIDTH*SCREENHEIGHT*2);
+    }
+    else
+    {
+        const u16* offsets = eraseList->offsets;
+        for (u32 i = 0; i < eraseList->count; ++i)
+        {
+            buffer[offsets[i]] = 0;
+        }
+    }
+    eraseList->count = 0;
+}
+
+// Everything left in the buffer came from the list, so clearing the whole
+// halfword around each pixel is safe and avoids a byte write to VRAM
+void EraseFrame8(u8* buffer, EraseList* eraseList)
+{
+    if (!eraseList->valid || eraseList->count >= ERASEFILLTHRESHOLD8)
+    {
+        FillWords(0, buffer, SCREENWIDTH*SCREENHEIGHT);
+    }
+    else
+    {
+        u16* pairs = (u16*)buffer;
+        const u16* offsets = eraseList->offsets;
+        for (u32 i = 0; i < eraseList->count; ++i)
+        {
+            pairs[offsets[i]>>1] = 0;
+        }
+    }
+    eraseList->count = 0;
+}
+
+void InvalidateEraseList(EraseList* eraseList)
+{
+    eraseList->valid = false;
+    eraseList->count = 0;
+}
+
+void InitFade(u8* buffer, FadeState* fade)
+{
+    FillWords(0, buffer, SCREENWIDTH*SCREENHEIGHT);
+    fade->slot = 0;
+    for (int i = 0; i < FADESLOTS; ++i)
+    {
+        InvalidateEraseList(&fade->slots[i]);
+    }
+}
+
+// Pixels drawn FADESLOTS frames ago are cleared just before their slot is
+// reused, unless a newer frame has since drawn over them
+void RenderFadeFrame(u8* buffer, const View* view, FadeState* fade)
+{
+    fade->slot = (fade->slot + 1) % FADESLOTS;
+    EraseList* eraseList = &fade->slots[fade->slot];
+
+    const u16* offsets = eraseList->offsets;
+    for (u32 i = 0; i < eraseList->count; ++i)
+    {
+        u8* pixel = buffer + offsets[i];
+        if (*pixel / FADECOLOURS == fade->slot)
+        {
+            PlotByte(pixel, 0);
+        }
+    }
+
+    u16* eraseEnd = RenderCurves(buffer, view, eraseList->offsets, true, 0, false, true, FadeIndexTable, fade->slot * FADECOLOURS, 0, true);
+    eraseList->count = eraseEnd - eraseList->offsets;
+    eraseList->valid = true;
+}
+
+void FadePalette(const FadeState* fade, u16* palette)
+{
+    palette[0] = 0;
+    for (int slot = 0; slot < FADESLOTS; ++slot)
+    {
+        const s32 brightness = FADESLOTS - ((fade->slot - slot) & (FADESLOTS-1));
+        for (int colour = 0; colour < FADECOLOURS; ++colour)
+        {
+            if (slot == 0 && colour == 0)
+            {
+                continue;
+            }
+            const u16 full = GradientColour(((colour>>2)<<2)|2, ((colour&3)<<3)|4);
+            const s32 red = ((full & 31) * brightness) / FADESLOTS;
+            const s32 green = (((full>>5) & 31) * brightness) / FADESLOTS;
+            const s32 blue = (((full>>10) & 31) * brightness) / FADESLOTS;
+            palette[slot*FADECOLOURS + colour] = red | (green<<5) | (blue<<10);
+        }
+    }
+}
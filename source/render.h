@@ -0,0 +1,151 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "platform.h"
+
+#ifndef CURVECOUNT
+#define CURVECOUNT 256
+#endif
+#ifndef CURVESTEP
+#define CURVESTEP 4
+#endif
+#ifndef ITERATIONS
+#define ITERATIONS 256
+#endif
+#define SIZE 96
+#define SCREENWIDTH 256
+#define SCREENHEIGHT 192
+#define PI 3.1415926535897932384626433832795
+#ifndef SINTABLEPOWER
+#define SINTABLEPOWER 14
+#endif
+#define SINTABLEENTRIES (1<<SINTABLEPOWER)
+#define ANG1INC (s32)((CURVESTEP * SINTABLEENTRIES) / 235)
+#define ANG2INC (s32)((CURVESTEP * SINTABLEENTRIES) / (2*PI))
+#define SCALEMUL (s32)(SIZE*PI)
+
+#define UNROLLCOUNT 4
+
+#define SINLAYOUTPACKED 0
+#define SINLAYOUTWAVE16 1
+#define SINLAYOUTQUARTER 2
+#ifndef SINLAYOUT
+#define SINLAYOUT SINLAYOUTPACKED
+#endif
+
+#define CURVES (CURVECOUNT/CURVESTEP)
+#define PARTICLECOUNT (ITERATIONS*CURVES)
+
+// DTCM is 16KB and the stack grows down from its top, so the tables placed
+// there, ColourTable first, must leave DTCMSTACKBYTES free
+#define DTCMBYTES 0x4000
+#define DTCMSTACKBYTES 0x1000
+#define DTCMCOLOURBYTES (PARTICLECOUNT/UNROLLCOUNT*2)
+#if SINLAYOUT == SINLAYOUTWAVE16 && DTCMCOLOURBYTES + SINTABLEENTRIES*2 <= DTCMBYTES - DTCMSTACKBYTES
+#define SINTABLEINDTCM 1
+#else
+#define SINTABLEINDTCM 0
+#endif
+
+// Erasing a listed pixel costs roughly twice a word of DMA fill, so past this
+// many entries clearing the whole screen is cheaper
+#ifndef ERASEFILLTHRESHOLD
+#define ERASEFILLTHRESHOLD (SCREENWIDTH*SCREENHEIGHT/4)
+#endif
+#define ERASEFILLTHRESHOLD8 (ERASEFILLTHRESHOLD/2)
+
+#define PALETTESIZE 256
+#define FADESLOTS 8
+#define FADECOLOURS (PALETTESIZE/FADESLOTS)
+
+typedef struct
+{
+    s32 animationTime;
+    s32 scaleMul;
+    s32 xPan;
+    s32 yPan;
+    u32 curves;
+    u32 iterations;
+} View;
+
+typedef struct
+{
+    bool valid;
+    u32 count;
+    u16 offsets[PARTICLECOUNT];
+} EraseList;
+
+typedef struct
+{
+    bool valid;
+    s32 animationTime;
+    u32 curves;
+    u32 iterations;
+    s32 points[PARTICLECOUNT];
+} PointCache;
+
+typedef struct
+{
+    u32 slot;
+    EraseList slots[FADESLOTS];
+} FadeState;
+
+// Fixed-size universes, each with its own specialised kernel. The active one's
+// colours take over ColourTable when they fit, so switching back to the general
+// kernels needs LoadUniverseColours(-1)
+#define UNIVERSESMALL 0
+#define UNIVERSEMEDIUM 1
+#define UNIVERSELARGE 2
+#define UNIVERSEHUGE 3
+#define UNIVERSES 4
+
+typedef struct
+{
+    const char* name;
+    u32 curveCount;
+    u32 curveStep;
+    u32 iterations;
+    u32 curves;
+    u32 particles;
+} Universe;
+
+extern const Universe Universes[UNIVERSES];
+extern const s16 compactsintable[SINTABLEENTRIES/4];
+#if SINLAYOUT == SINLAYOUTPACKED
+extern s32 SinTable[SINTABLEENTRIES];
+#elif SINLAYOUT == SINLAYOUTWAVE16
+extern s16 SinTable[SINTABLEENTRIES];
+#endif
+extern u16 ColourTable[PARTICLECOUNT/UNROLLCOUNT];
+extern u8 ColourIndexTable[PARTICLECOUNT/UNROLLCOUNT];
+extern u8 FadeIndexTable[PARTICLECOUNT/UNROLLCOUNT];
+extern u16 Palette[PALETTESIZE];
+// Clearing this renders without view culling, which is the reference for it
+extern bool CullingEnabled;
+#ifdef ARMKERNEL
+// Clearing this falls back to the C kernel, which is the reference for kernelarm.s
+extern bool ArmKernelEnabled;
+#endif
+
+void ExpandPackedSinTable(s32* table);
+void ExpandWaveSinTable(s16* table);
+void ExpandSinTable();
+void InitColourTable();
+void InitPalette();
+void RenderFrame(u16* buffer, const View* view, EraseList* eraseList, PointCache* pointCache);
+void RenderFrame8(u8* buffer, const View* view, EraseList* eraseList, PointCache* pointCache);
+void ComputeCurvePoints(const View* view, u32 firstCurve, u32 curves, s32* points);
+u32 ProjectCurves(const View* view, u32 firstCurve, u32 curves, u32* plots);
+bool PointCacheMatches(const PointCache* pointCache, const View* view);
+void LoadUniverseColours(s32 universe);
+void RenderUniverseFrame(u32 universe, u16* buffer, const View* view, EraseList* eraseList);
+void PlotCachedFrame(u16* buffer, const View* view, EraseList* eraseList, const PointCache* pointCache);
+void PlotCachedFrame8(u8* buffer, const View* view, EraseList* eraseList, const PointCache* pointCache);
+void EraseFrame(u16* buffer, EraseList* eraseList);
+void EraseFrame8(u8* buffer, EraseList* eraseList);
+void InvalidateEraseList(EraseList* eraseList);
+void InitFade(u8* buffer, FadeState* fade);
+void RenderFadeFrame(u8* buffer, const View* view, FadeState* fade);
+void FadePalette(const FadeState* fade, u16* palette);
+
+#endif
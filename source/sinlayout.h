@@ -0,0 +1,37 @@
+#ifndef SINLAYOUT_H
+#define SINLAYOUT_H
+
+#include "render.h"
+
+// Each layout looks up the sine and cosine of an angle already masked to
+// [0, SINTABLEENTRIES), giving identical values for the same generated table
+
+// s32 entries holding sin in the low half and cos in the high half
+#define SINCOSPACKED(table, angle, s, c) \
+    { \
+        const s32 packed = (table)[angle]; \
+        s = (s16)packed; \
+        c = packed>>16; \
+    }
+
+// One s16 wave, cos is sin a quarter turn further on
+#define SINCOSWAVE16(table, angle, s, c) \
+    { \
+        s = (table)[angle]; \
+        c = (table)[((angle) + SINTABLEENTRIES/4)&(SINTABLEENTRIES-1)]; \
+    }
+
+// The first quarter of the wave, mirrored in odd quadrants and negated in the
+// second half of the turn
+#define QUARTERSIN(table, angle) \
+    ((angle)&(SINTABLEENTRIES/2) ? \
+        -(table)[((angle) ^ ((angle)&(SINTABLEENTRIES/4) ? SINTABLEENTRIES/4-1 : 0))&(SINTABLEENTRIES/4-1)] : \
+        (table)[((angle) ^ ((angle)&(SINTABLEENTRIES/4) ? SINTABLEENTRIES/4-1 : 0))&(SINTABLEENTRIES/4-1)])
+
+#define SINCOSQUARTER(table, angle, s, c) \
+    { \
+        s = QUARTERSIN(table, angle); \
+        c = QUARTERSIN(table, ((angle) + SINTABLEENTRIES/4)&(SINTABLEENTRIES-1)); \
+    }
+
+#endif
@@ -0,0 +1,34 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define PI 3.1415926535897932384626433832795
+
+// Writes the first quarter of a sine wave with SINTABLEENTRIES = 1<<power
+// entries per turn and an amplitude of SINTABLEENTRIES/(2*PI), so one unit of
+// angle moves a point on the curve by roughly one unit of distance
+int main(int argc, char** argv)
+{
+    int power = argc > 1 ? atoi(argv[1]) : 14;
+    if (power < 4 || power > 16)
+    {
+        fprintf(stderr, "usage: gensintable [power 4-16]\n");
+        return 1;
+    }
+
+    int entries = 1 << power;
+    double amplitude = entries / (2*PI);
+
+    printf("// Generated by tools/gensintable.c for SINTABLEPOWER %d, do not edit\n", power);
+    printf("const s16 compactsintable[SINTABLEENTRIES/4] = {\n");
+    for (int i = 0; i < entries/4; ++i)
+    {
+        printf("0x%04x,", (int)floor(sin(i*2*PI/entries) * amplitude));
+        if (i % 16 == 15 || i == entries/4 - 1)
+        {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+    return 0;
+}